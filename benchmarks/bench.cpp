@@ -0,0 +1,115 @@
+#include "merve.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Runs lexer::parse_commonjs over every .js file in the corpus directory
+// (benchmarks/data by default, or $MERVE_BENCHMARK_CORPUS when set).
+//
+// - parse/<file>: one benchmark per file, reporting bytes/s and exports/s.
+// - parse_corpus: parses the whole corpus per iteration and reports the
+//   per-file latency percentiles (p50/p90/p99) in nanoseconds.
+//
+// The SIMD implementation in use is reported in the context header; set
+// MERVE_FORCE_IMPLEMENTATION (e.g. to "scalar") to compare implementations.
+
+namespace {
+
+struct corpus_file {
+  std::string name;
+  std::string contents;
+};
+
+std::vector<corpus_file> load_corpus(const std::filesystem::path& dir) {
+  std::vector<corpus_file> files;
+  for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+    if (!entry.is_regular_file() || entry.path().extension() != ".js") continue;
+    std::ifstream in(entry.path(), std::ios::binary);
+    files.push_back(corpus_file{
+        entry.path().filename().string(),
+        std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>())});
+  }
+  std::sort(files.begin(), files.end(),
+            [](const corpus_file& a, const corpus_file& b) { return a.name < b.name; });
+  return files;
+}
+
+double percentile(std::vector<double>& samples, double p) {
+  if (samples.empty()) return 0;
+  auto nth = samples.begin() + static_cast<ptrdiff_t>(p * static_cast<double>(samples.size() - 1));
+  std::nth_element(samples.begin(), nth, samples.end());
+  return *nth;
+}
+
+void BM_parse_file(benchmark::State& state, const corpus_file* file) {
+  size_t exports = 0;
+  for (auto _ : state) {
+    auto result = lexer::parse_commonjs(file->contents);
+    if (!result) {
+      state.SkipWithError("parse_commonjs failed");
+      break;
+    }
+    exports += result->exports.size() + result->re_exports.size();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(file->contents.size()));
+  state.counters["exports"] =
+      benchmark::Counter(static_cast<double>(exports), benchmark::Counter::kIsRate);
+}
+
+void BM_parse_corpus(benchmark::State& state, const std::vector<corpus_file>* corpus) {
+  std::vector<double> latencies;
+  size_t bytes = 0;
+  size_t exports = 0;
+  for (auto _ : state) {
+    for (const auto& file : *corpus) {
+      auto start = std::chrono::steady_clock::now();
+      auto result = lexer::parse_commonjs(file.contents);
+      auto stop = std::chrono::steady_clock::now();
+      benchmark::DoNotOptimize(result);
+      latencies.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+      bytes += file.contents.size();
+      if (result) exports += result->exports.size() + result->re_exports.size();
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.counters["exports"] =
+      benchmark::Counter(static_cast<double>(exports), benchmark::Counter::kIsRate);
+  state.counters["p50_ns"] = percentile(latencies, 0.50);
+  state.counters["p90_ns"] = percentile(latencies, 0.90);
+  state.counters["p99_ns"] = percentile(latencies, 0.99);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* dir = std::getenv("MERVE_BENCHMARK_CORPUS");
+  static const std::vector<corpus_file> corpus =
+      load_corpus(dir != nullptr ? dir : MERVE_BENCHMARK_DATA_DIR);
+  if (corpus.empty()) {
+    std::cerr << "No .js files found in the benchmark corpus." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (const auto& file : corpus) {
+    benchmark::RegisterBenchmark(("parse/" + file.name).c_str(), BM_parse_file, &file);
+  }
+  benchmark::RegisterBenchmark("parse_corpus", BM_parse_corpus, &corpus);
+
+  benchmark::AddCustomContext("implementation", std::string(lexer::get_active_implementation().name()));
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return EXIT_FAILURE;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
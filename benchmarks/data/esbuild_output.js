@@ -0,0 +1,144 @@
+"use strict";
+var __defProp = Object.defineProperty;
+var __getOwnPropDesc = Object.getOwnPropertyDescriptor;
+var __getOwnPropNames = Object.getOwnPropertyNames;
+var __hasOwnProp = Object.prototype.hasOwnProperty;
+var __export = (target, all) => {
+  for (var name in all)
+    __defProp(target, name, { get: all[name], enumerable: true });
+};
+var __copyProps = (to, from, except, desc) => {
+  if (from && typeof from === "object" || typeof from === "function") {
+    for (let key of __getOwnPropNames(from))
+      if (!__hasOwnProp.call(to, key) && key !== except)
+        __defProp(to, key, { get: () => from[key], enumerable: !(desc = __getOwnPropDesc(from, key)) || desc.enumerable });
+  }
+  return to;
+};
+var __reExport = (target, mod, secondTarget) => (__copyProps(target, mod, "default"), secondTarget && __copyProps(secondTarget, mod, "default"));
+var __toCommonJS = (mod) => __copyProps(__defProp({}, "__esModule", { value: true }), mod);
+
+// src/index.ts
+var src_exports = {};
+__export(src_exports, {
+  Parser: () => Parser,
+  Tokenizer: () => Tokenizer,
+  parse: () => parse,
+  stringify: () => stringify,
+  tokenize: () => tokenize,
+  visit: () => visit
+});
+module.exports = __toCommonJS(src_exports);
+
+// src/tokenizer.ts
+var WHITESPACE = /[ \t\r\n]/;
+var PUNCT = /[{}[\],:]/;
+var Tokenizer = class {
+  constructor(input) {
+    this.input = input;
+    this.pos = 0;
+    this.line = 1;
+  }
+  next() {
+    while (this.pos < this.input.length && WHITESPACE.test(this.input[this.pos])) {
+      if (this.input[this.pos] === "\n") this.line++;
+      this.pos++;
+    }
+    if (this.pos >= this.input.length) return { type: "eof", line: this.line };
+    const ch = this.input[this.pos];
+    if (PUNCT.test(ch)) {
+      this.pos++;
+      return { type: "punct", value: ch, line: this.line };
+    }
+    if (ch === '"') return this.string();
+    return this.atom();
+  }
+  string() {
+    let end = this.pos + 1;
+    while (end < this.input.length && this.input[end] !== '"') {
+      if (this.input[end] === "\\") end++;
+      end++;
+    }
+    const value = this.input.slice(this.pos + 1, end);
+    this.pos = end + 1;
+    return { type: "string", value, line: this.line };
+  }
+  atom() {
+    const start = this.pos;
+    while (this.pos < this.input.length && !WHITESPACE.test(this.input[this.pos]) && !PUNCT.test(this.input[this.pos])) this.pos++;
+    return { type: "atom", value: this.input.slice(start, this.pos), line: this.line };
+  }
+};
+function tokenize(input) {
+  const t = new Tokenizer(input);
+  const out = [];
+  for (let tok = t.next(); tok.type !== "eof"; tok = t.next()) out.push(tok);
+  return out;
+}
+
+// src/parser.ts
+var Parser = class {
+  constructor(tokens) {
+    this.tokens = tokens;
+    this.index = 0;
+  }
+  parseValue() {
+    const tok = this.tokens[this.index++];
+    if (!tok) throw new SyntaxError("Unexpected end of input");
+    if (tok.type === "punct" && tok.value === "{") return this.parseObject();
+    if (tok.type === "punct" && tok.value === "[") return this.parseArray();
+    if (tok.type === "string") return tok.value;
+    if (tok.value === "true") return true;
+    if (tok.value === "false") return false;
+    if (tok.value === "null") return null;
+    return Number(tok.value);
+  }
+  parseObject() {
+    const obj = {};
+    while (this.tokens[this.index]?.value !== "}") {
+      const key = this.parseValue();
+      this.index++;
+      obj[key] = this.parseValue();
+      if (this.tokens[this.index]?.value === ",") this.index++;
+    }
+    this.index++;
+    return obj;
+  }
+  parseArray() {
+    const arr = [];
+    while (this.tokens[this.index]?.value !== "]") {
+      arr.push(this.parseValue());
+      if (this.tokens[this.index]?.value === ",") this.index++;
+    }
+    this.index++;
+    return arr;
+  }
+};
+function parse(input) {
+  return new Parser(tokenize(input)).parseValue();
+}
+
+// src/visit.ts
+function visit(node, fn, path = []) {
+  fn(node, path);
+  if (Array.isArray(node)) node.forEach((child, i) => visit(child, fn, [...path, i]));
+  else if (node && typeof node === "object") for (const [k, v] of Object.entries(node)) visit(v, fn, [...path, k]);
+}
+function stringify(value, indent = 0) {
+  const pad = " ".repeat(indent);
+  if (Array.isArray(value)) return `[${value.map((v) => stringify(v, indent)).join(", ")}]`;
+  if (value && typeof value === "object") {
+    return `{\n${Object.entries(value).map(([k, v]) => `${pad}  "${k}": ${stringify(v, indent + 2)}`).join(",\n")}\n${pad}}`;
+  }
+  return JSON.stringify(value);
+}
+// Annotate the CommonJS export names for ESM import in node:
+0 && (module.exports = {
+  Parser,
+  Tokenizer,
+  parse,
+  stringify,
+  tokenize,
+  visit,
+  ...require("./plugins")
+});
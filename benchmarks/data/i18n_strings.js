@@ -0,0 +1,308 @@
+"use strict";
+Object.defineProperty(exports, "__esModule", { value: true });
+var styles = ".c0{display:flex;align-items:center;justify-content:space-between;padding:0px 0px;margin:0 auto;color:#000000;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c1{display:flex;align-items:center;justify-content:space-between;padding:1px 1px;margin:0 auto;color:#377a4f;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c2{display:flex;align-items:center;justify-content:space-between;padding:2px 2px;margin:0 auto;color:#6ef49e;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c3{display:flex;align-items:center;justify-content:space-between;padding:3px 3px;margin:0 auto;color:#a66eed;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c4{display:flex;align-items:center;justify-content:space-between;padding:4px 4px;margin:0 auto;color:#dde93c;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c5{display:flex;align-items:center;justify-content:space-between;padding:5px 5px;margin:0 auto;color:#15638c;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c6{display:flex;align-items:center;justify-content:space-between;padding:6px 6px;margin:0 auto;color:#4cdddb;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c7{display:flex;align-items:center;justify-content:space-between;padding:7px 0px;margin:0 auto;color:#84582a;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c8{display:flex;align-items:center;justify-content:space-between;padding:8px 1px;margin:0 auto;color:#bbd279;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c9{display:flex;align-items:center;justify-content:space-between;padding:0px 2px;margin:0 auto;color:#f34cc8;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c10{display:flex;align-items:center;justify-content:space-between;padding:1px 3px;margin:0 auto;color:#2ac718;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c11{display:flex;align-items:center;justify-content:space-between;padding:2px 4px;margin:0 auto;color:#624167;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c12{display:flex;align-items:center;justify-content:space-between;padding:3px 5px;margin:0 auto;color:#99bbb6;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c13{display:flex;align-items:center;justify-content:space-between;padding:4px 6px;margin:0 auto;color:#d13605;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c14{display:flex;align-items:center;justify-content:space-between;padding:5px 0px;margin:0 auto;color:#08b055;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c15{display:flex;align-items:center;justify-content:space-between;padding:6px 1px;margin:0 auto;color:#402aa4;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c16{display:flex;align-items:center;justify-content:space-between;padding:7px 2px;margin:0 auto;color:#77a4f3;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c17{display:flex;align-items:center;justify-content:space-between;padding:8px 3px;margin:0 auto;color:#af1f42;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c18{display:flex;align-items:center;justify-content:space-between;padding:0px 4px;margin:0 auto;color:#e69991;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c19{display:flex;align-items:center;justify-content:space-between;padding:1px 5px;margin:0 auto;color:#1e13e1;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c20{display:flex;align-items:center;justify-content:space-between;padding:2px 6px;margin:0 auto;color:#558e30;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c21{display:flex;align-items:center;justify-content:space-between;padding:3px 0px;margin:0 auto;color:#8d087f;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c22{display:flex;align-items:center;justify-content:space-between;padding:4px 1px;margin:0 auto;color:#c482ce;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c23{display:flex;align-items:center;justify-content:space-between;padding:5px 2px;margin:0 auto;color:#fbfd1d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c24{display:flex;align-items:center;justify-content:space-between;padding:6px 3px;margin:0 auto;color:#33776d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c25{display:flex;align-items:center;justify-content:space-between;padding:7px 4px;margin:0 auto;color:#6af1bc;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c26{display:flex;align-items:center;justify-content:space-between;padding:8px 5px;margin:0 auto;color:#a26c0b;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c27{display:flex;align-items:center;justify-content:space-between;padding:0px 6px;margin:0 auto;color:#d9e65a;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c28{display:flex;align-items:center;justify-content:space-between;padding:1px 0px;margin:0 auto;color:#1160aa;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c29{display:flex;align-items:center;justify-content:space-between;padding:2px 1px;margin:0 auto;color:#48daf9;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c30{display:flex;align-items:center;justify-content:space-between;padding:3px 2px;margin:0 auto;color:#805548;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c31{display:flex;align-items:center;justify-content:space-between;padding:4px 3px;margin:0 auto;color:#b7cf97;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c32{display:flex;align-items:center;justify-content:space-between;padding:5px 4px;margin:0 auto;color:#ef49e6;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c33{display:flex;align-items:center;justify-content:space-between;padding:6px 5px;margin:0 auto;color:#26c436;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c34{display:flex;align-items:center;justify-content:space-between;padding:7px 6px;margin:0 auto;color:#5e3e85;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c35{display:flex;align-items:center;justify-content:space-between;padding:8px 0px;margin:0 auto;color:#95b8d4;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c36{display:flex;align-items:center;justify-content:space-between;padding:0px 1px;margin:0 auto;color:#cd3323;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c37{display:flex;align-items:center;justify-content:space-between;padding:1px 2px;margin:0 auto;color:#04ad73;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c38{display:flex;align-items:center;justify-content:space-between;padding:2px 3px;margin:0 auto;color:#3c27c2;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c39{display:flex;align-items:center;justify-content:space-between;padding:3px 4px;margin:0 auto;color:#73a211;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c40{display:flex;align-items:center;justify-content:space-between;padding:4px 5px;margin:0 auto;color:#ab1c60;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c41{display:flex;align-items:center;justify-content:space-between;padding:5px 6px;margin:0 auto;color:#e296af;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c42{display:flex;align-items:center;justify-content:space-between;padding:6px 0px;margin:0 auto;color:#1a10ff;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c43{display:flex;align-items:center;justify-content:space-between;padding:7px 1px;margin:0 auto;color:#518b4e;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c44{display:flex;align-items:center;justify-content:space-between;padding:8px 2px;margin:0 auto;color:#89059d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c45{display:flex;align-items:center;justify-content:space-between;padding:0px 3px;margin:0 auto;color:#c07fec;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c46{display:flex;align-items:center;justify-content:space-between;padding:1px 4px;margin:0 auto;color:#f7fa3b;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c47{display:flex;align-items:center;justify-content:space-between;padding:2px 5px;margin:0 auto;color:#2f748b;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c48{display:flex;align-items:center;justify-content:space-between;padding:3px 6px;margin:0 auto;color:#66eeda;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c49{display:flex;align-items:center;justify-content:space-between;padding:4px 0px;margin:0 auto;color:#9e6929;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c50{display:flex;align-items:center;justify-content:space-between;padding:5px 1px;margin:0 auto;color:#d5e378;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c51{display:flex;align-items:center;justify-content:space-between;padding:6px 2px;margin:0 auto;color:#0d5dc8;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c52{display:flex;align-items:center;justify-content:space-between;padding:7px 3px;margin:0 auto;color:#44d817;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c53{display:flex;align-items:center;justify-content:space-between;padding:8px 4px;margin:0 auto;color:#7c5266;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c54{display:flex;align-items:center;justify-content:space-between;padding:0px 5px;margin:0 auto;color:#b3ccb5;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c55{display:flex;align-items:center;justify-content:space-between;padding:1px 6px;margin:0 auto;color:#eb4704;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c56{display:flex;align-items:center;justify-content:space-between;padding:2px 0px;margin:0 auto;color:#22c154;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c57{display:flex;align-items:center;justify-content:space-between;padding:3px 1px;margin:0 auto;color:#5a3ba3;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c58{display:flex;align-items:center;justify-content:space-between;padding:4px 2px;margin:0 auto;color:#91b5f2;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c59{display:flex;align-items:center;justify-content:space-between;padding:5px 3px;margin:0 auto;color:#c93041;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c60{display:flex;align-items:center;justify-content:space-between;padding:6px 4px;margin:0 auto;color:#00aa91;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c61{display:flex;align-items:center;justify-content:space-between;padding:7px 5px;margin:0 auto;color:#3824e0;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c62{display:flex;align-items:center;justify-content:space-between;padding:8px 6px;margin:0 auto;color:#6f9f2f;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c63{display:flex;align-items:center;justify-content:space-between;padding:0px 0px;margin:0 auto;color:#a7197e;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c64{display:flex;align-items:center;justify-content:space-between;padding:1px 1px;margin:0 auto;color:#de93cd;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c65{display:flex;align-items:center;justify-content:space-between;padding:2px 2px;margin:0 auto;color:#160e1d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c66{display:flex;align-items:center;justify-content:space-between;padding:3px 3px;margin:0 auto;color:#4d886c;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c67{display:flex;align-items:center;justify-content:space-between;padding:4px 4px;margin:0 auto;color:#8502bb;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c68{display:flex;align-items:center;justify-content:space-between;padding:5px 5px;margin:0 auto;color:#bc7d0a;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c69{display:flex;align-items:center;justify-content:space-between;padding:6px 6px;margin:0 auto;color:#f3f759;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c70{display:flex;align-items:center;justify-content:space-between;padding:7px 0px;margin:0 auto;color:#2b71a9;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c71{display:flex;align-items:center;justify-content:space-between;padding:8px 1px;margin:0 auto;color:#62ebf8;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c72{display:flex;align-items:center;justify-content:space-between;padding:0px 2px;margin:0 auto;color:#9a6647;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c73{display:flex;align-items:center;justify-content:space-between;padding:1px 3px;margin:0 auto;color:#d1e096;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c74{display:flex;align-items:center;justify-content:space-between;padding:2px 4px;margin:0 auto;color:#095ae6;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c75{display:flex;align-items:center;justify-content:space-between;padding:3px 5px;margin:0 auto;color:#40d535;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c76{display:flex;align-items:center;justify-content:space-between;padding:4px 6px;margin:0 auto;color:#784f84;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c77{display:flex;align-items:center;justify-content:space-between;padding:5px 0px;margin:0 auto;color:#afc9d3;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c78{display:flex;align-items:center;justify-content:space-between;padding:6px 1px;margin:0 auto;color:#e74422;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c79{display:flex;align-items:center;justify-content:space-between;padding:7px 2px;margin:0 auto;color:#1ebe72;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c80{display:flex;align-items:center;justify-content:space-between;padding:8px 3px;margin:0 auto;color:#5638c1;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c81{display:flex;align-items:center;justify-content:space-between;padding:0px 4px;margin:0 auto;color:#8db310;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c82{display:flex;align-items:center;justify-content:space-between;padding:1px 5px;margin:0 auto;color:#c52d5f;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c83{display:flex;align-items:center;justify-content:space-between;padding:2px 6px;margin:0 auto;color:#fca7ae;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c84{display:flex;align-items:center;justify-content:space-between;padding:3px 0px;margin:0 auto;color:#3421fe;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c85{display:flex;align-items:center;justify-content:space-between;padding:4px 1px;margin:0 auto;color:#6b9c4d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c86{display:flex;align-items:center;justify-content:space-between;padding:5px 2px;margin:0 auto;color:#a3169c;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c87{display:flex;align-items:center;justify-content:space-between;padding:6px 3px;margin:0 auto;color:#da90eb;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c88{display:flex;align-items:center;justify-content:space-between;padding:7px 4px;margin:0 auto;color:#120b3b;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c89{display:flex;align-items:center;justify-content:space-between;padding:8px 5px;margin:0 auto;color:#49858a;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c90{display:flex;align-items:center;justify-content:space-between;padding:0px 6px;margin:0 auto;color:#80ffd9;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c91{display:flex;align-items:center;justify-content:space-between;padding:1px 0px;margin:0 auto;color:#b87a28;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c92{display:flex;align-items:center;justify-content:space-between;padding:2px 1px;margin:0 auto;color:#eff477;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c93{display:flex;align-items:center;justify-content:space-between;padding:3px 2px;margin:0 auto;color:#276ec7;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c94{display:flex;align-items:center;justify-content:space-between;padding:4px 3px;margin:0 auto;color:#5ee916;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c95{display:flex;align-items:center;justify-content:space-between;padding:5px 4px;margin:0 auto;color:#966365;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c96{display:flex;align-items:center;justify-content:space-between;padding:6px 5px;margin:0 auto;color:#cdddb4;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c97{display:flex;align-items:center;justify-content:space-between;padding:7px 6px;margin:0 auto;color:#055804;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c98{display:flex;align-items:center;justify-content:space-between;padding:8px 0px;margin:0 auto;color:#3cd253;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c99{display:flex;align-items:center;justify-content:space-between;padding:0px 1px;margin:0 auto;color:#744ca2;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c100{display:flex;align-items:center;justify-content:space-between;padding:1px 2px;margin:0 auto;color:#abc6f1;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c101{display:flex;align-items:center;justify-content:space-between;padding:2px 3px;margin:0 auto;color:#e34140;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c102{display:flex;align-items:center;justify-content:space-between;padding:3px 4px;margin:0 auto;color:#1abb90;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c103{display:flex;align-items:center;justify-content:space-between;padding:4px 5px;margin:0 auto;color:#5235df;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c104{display:flex;align-items:center;justify-content:space-between;padding:5px 6px;margin:0 auto;color:#89b02e;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c105{display:flex;align-items:center;justify-content:space-between;padding:6px 0px;margin:0 auto;color:#c12a7d;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c106{display:flex;align-items:center;justify-content:space-between;padding:7px 1px;margin:0 auto;color:#f8a4cc;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c107{display:flex;align-items:center;justify-content:space-between;padding:8px 2px;margin:0 auto;color:#301f1c;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c108{display:flex;align-items:center;justify-content:space-between;padding:0px 3px;margin:0 auto;color:#67996b;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c109{display:flex;align-items:center;justify-content:space-between;padding:1px 4px;margin:0 auto;color:#9f13ba;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c110{display:flex;align-items:center;justify-content:space-between;padding:2px 5px;margin:0 auto;color:#d68e09;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c111{display:flex;align-items:center;justify-content:space-between;padding:3px 6px;margin:0 auto;color:#0e0859;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c112{display:flex;align-items:center;justify-content:space-between;padding:4px 0px;margin:0 auto;color:#4582a8;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c113{display:flex;align-items:center;justify-content:space-between;padding:5px 1px;margin:0 auto;color:#7cfcf7;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c114{display:flex;align-items:center;justify-content:space-between;padding:6px 2px;margin:0 auto;color:#b47746;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c115{display:flex;align-items:center;justify-content:space-between;padding:7px 3px;margin:0 auto;color:#ebf195;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c116{display:flex;align-items:center;justify-content:space-between;padding:8px 4px;margin:0 auto;color:#236be5;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c117{display:flex;align-items:center;justify-content:space-between;padding:0px 5px;margin:0 auto;color:#5ae634;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c118{display:flex;align-items:center;justify-content:space-between;padding:1px 6px;margin:0 auto;color:#926083;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif} .c119{display:flex;align-items:center;justify-content:space-between;padding:2px 0px;margin:0 auto;color:#c9dad2;font:400 14px/1.5 system-ui,-apple-system,\"Segoe UI\",Roboto,sans-serif}";
+var messages = {
+  'msg.0': 'Jumps notification save quick brown theme fox password dark quick display lazy quick brown \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.1': 'Privacy brown dog brown theme privacy quick dark fox dog save save dark quick dark dark notification.',
+  'msg.2': 'Dog quick theme jumps profile.',
+  'msg.3': 'Jumps theme fox dark profile theme cancel over fox dark dark save lazy password fox theme delete.',
+  'msg.4': 'Dark quick light lazy region cancel.',
+  'msg.5': 'Privacy account language dark language password profile dog over delete dog brown dark profile display region account confirm language profile light.',
+  'msg.6': 'Fox display privacy over account jumps.',
+  'msg.7': 'Privacy quick cancel brown theme dark account account delete password light region dark language brown brown settings region delete.',
+  'msg.8': 'Brown quick confirm delete profile save dark cancel language profile delete notification cancel password the language password over light fox region quick lazy profile jumps.',
+  'msg.9': 'Dog notification notification region brown over language notification theme settings jumps privacy theme settings delete privacy password cancel notification dog jumps brown over jumps dog cancel dog.',
+  'msg.10': 'Region dark over settings.',
+  'msg.11': 'The jumps privacy theme password light dark account jumps delete display light save.',
+  'msg.12': 'Confirm quick language cancel theme notification notification notification notification fox region save notification quick lazy brown lazy language over fox account light quick fox the.',
+  'msg.13': 'Jumps theme fox password light the brown lazy light notification jumps save settings password light password region fox fox region language region.',
+  'msg.14': 'Profile brown jumps fox confirm account confirm settings region delete over display the lazy display password jumps delete theme.',
+  'msg.15': 'Display profile save brown.',
+  'msg.16': 'Settings display password over password dog theme theme display account save dog light lazy dog notification confirm dog lazy display region password confirm the the settings.',
+  'msg.17': 'Settings lazy delete light password language confirm password password brown dog fox dog region lazy account lazy region light \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.18': 'The region save password save brown cancel fox notification delete lazy region over privacy save account brown confirm notification language notification confirm brown.',
+  'msg.19': 'Over over jumps the jumps dark language save jumps light light region cancel password jumps theme theme jumps the the confirm save fox display confirm jumps privacy.',
+  'msg.20': 'Lazy the settings lazy profile display dog dark account settings.',
+  'msg.21': 'Privacy jumps quick confirm password language cancel dark display privacy display jumps theme jumps display display the language over light the.',
+  'msg.22': 'Jumps over jumps region light confirm fox theme quick account cancel display display theme region fox theme quick dog lazy settings quick fox display language theme the brown.',
+  'msg.23': 'Account light display light display lazy delete settings language display theme region display dog delete display settings theme.',
+  'msg.24': 'Language jumps privacy fox notification language account brown cancel dog.',
+  'msg.25': 'Brown lazy cancel profile fox jumps delete save cancel password jumps settings jumps language dog confirm fox.',
+  'msg.26': 'Region over cancel dog over delete privacy display notification account privacy lazy password account brown confirm.',
+  'msg.27': 'The account theme language language delete the notification account display light profile display brown fox.',
+  'msg.28': 'Dog fox brown settings settings quick over settings jumps privacy cancel settings notification jumps theme display dark region delete account brown settings quick delete over privacy brown settings the.',
+  'msg.29': 'Brown settings brown light dog brown settings fox language the account theme privacy settings light jumps quick display delete dog fox over settings quick.',
+  'msg.30': 'Lazy profile save profile display lazy profile language display.',
+  'msg.31': 'Over settings password the settings quick the the confirm display theme lazy display region dog language fox cancel save privacy cancel region theme notification display.',
+  'msg.32': 'Delete lazy dog account lazy delete confirm save jumps notification password quick jumps.',
+  'msg.33': 'Brown save confirm settings.',
+  'msg.34': 'Over quick brown cancel notification display cancel profile light dog delete profile quick language over over settings \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.35': 'The settings password account theme account dog quick profile lazy password over the account notification brown region settings.',
+  'msg.36': 'Save lazy dog display the brown settings brown jumps notification dark quick notification the profile profile save dog brown dark.',
+  'msg.37': 'Jumps cancel delete light notification account confirm region jumps profile confirm light save jumps quick delete display save privacy confirm.',
+  'msg.38': 'Display jumps display display dark the cancel dark delete cancel delete save dog brown the quick jumps save password fox notification language theme quick save the.',
+  'msg.39': 'Theme cancel dog region settings the language brown confirm display theme brown cancel display brown confirm confirm region settings brown settings dog confirm lazy.',
+  'msg.40': 'Confirm save language region notification brown region cancel profile quick light.',
+  'msg.41': 'Save lazy brown light jumps account settings save confirm delete profile light dark jumps the region quick region settings cancel fox delete lazy cancel.',
+  'msg.42': 'Profile delete display profile language language language fox theme lazy profile brown region the profile language brown display language.',
+  'msg.43': 'Notification lazy lazy brown dark brown jumps confirm display settings password jumps.',
+  'msg.44': 'Save display settings fox delete password dog region region notification the over the region cancel language notification profile confirm jumps privacy password notification.',
+  'msg.45': 'Fox account the account account notification fox lazy delete the confirm profile settings password.',
+  'msg.46': 'Notification notification dark brown password privacy.',
+  'msg.47': 'Settings quick settings fox quick cancel profile save jumps dog settings privacy display account lazy password privacy the save notification theme theme lazy confirm brown quick confirm privacy.',
+  'msg.48': 'Light jumps save profile region quick theme jumps over region privacy account profile profile settings confirm confirm save.',
+  'msg.49': 'Notification save dog profile region theme cancel notification fox over save over.',
+  'msg.50': 'Lazy display region theme dog language.',
+  'msg.51': 'Language privacy jumps theme lazy dog brown over account theme brown account dog password \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.52': 'Dark lazy the confirm privacy notification privacy confirm display lazy notification settings.',
+  'msg.53': 'Quick region settings dark password jumps cancel display display save lazy brown settings dog.',
+  'msg.54': 'Notification save language privacy profile the jumps quick privacy delete region dark region the brown notification.',
+  'msg.55': 'Display language language dog fox dog jumps jumps display cancel fox confirm delete save language brown theme quick the jumps dog dark quick save delete profile jumps save settings display.',
+  'msg.56': 'Privacy delete fox fox brown profile display dark lazy notification settings dog light the the theme profile language settings account save dog region display.',
+  'msg.57': 'Theme dog the privacy delete save profile quick the lazy region.',
+  'msg.58': 'Save privacy brown settings dog cancel privacy password dog region quick delete account delete privacy password cancel notification lazy the profile confirm display brown lazy.',
+  'msg.59': 'Lazy profile lazy dog language dog settings profile fox light region light over dog region privacy cancel quick light.',
+  'msg.60': 'Notification quick lazy the light jumps privacy quick.',
+  'msg.61': 'Quick over notification language delete account confirm fox brown over account lazy over save display confirm language quick profile cancel confirm notification password account language over.',
+  'msg.62': 'The brown settings brown password privacy fox.',
+  'msg.63': 'Lazy notification password profile privacy brown quick delete region lazy password theme language lazy account password confirm region the save privacy.',
+  'msg.64': 'Save notification quick notification quick language brown quick settings lazy confirm.',
+  'msg.65': 'Light account password settings account light.',
+  'msg.66': 'Settings confirm delete delete account.',
+  'msg.67': 'Profile the confirm light save brown the dog fox region delete language.',
+  'msg.68': 'Notification settings privacy region jumps region over the confirm profile delete jumps light dog account account language password light brown display lazy notification over dog privacy brown save \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.69': 'Region theme theme account over.',
+  'msg.70': 'Fox brown settings light brown lazy fox privacy region delete language over dog jumps privacy language light.',
+  'msg.71': 'Dog confirm theme cancel fox profile profile settings dark settings password settings confirm settings lazy language dog over dog dog jumps profile dark lazy account.',
+  'msg.72': 'Notification settings dog display display dog.',
+  'msg.73': 'Fox save language quick fox the region dog language password quick profile dog fox quick lazy light dark lazy brown password display over language.',
+  'msg.74': 'Settings cancel the fox save light delete light password lazy quick password account jumps quick lazy settings quick light confirm save lazy the.',
+  'msg.75': 'Account privacy cancel password over light profile brown lazy quick region theme region brown privacy fox notification cancel theme jumps save theme brown save over notification delete settings privacy profile.',
+  'msg.76': 'Profile privacy quick profile confirm dark password privacy privacy the password save lazy notification confirm notification lazy the privacy over privacy fox brown notification dark.',
+  'msg.77': 'Language over jumps the quick theme jumps save notification brown dark light password confirm display.',
+  'msg.78': 'Jumps password profile over display over brown fox notification.',
+  'msg.79': 'Lazy profile jumps quick region account quick light save notification brown delete light delete over save dog light notification.',
+  'msg.80': 'Lazy region over dark lazy quick notification display over notification password fox jumps dog confirm lazy quick theme cancel quick cancel account fox.',
+  'msg.81': 'Light language theme save profile save privacy profile dark dog privacy notification cancel password language display.',
+  'msg.82': 'Over the the light region language dog language light language over region notification fox brown jumps password privacy.',
+  'msg.83': 'Brown language display display cancel quick quick save jumps brown confirm account confirm display brown.',
+  'msg.84': 'Display notification save jumps the.',
+  'msg.85': 'Light confirm delete fox lazy jumps \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.86': 'Profile over cancel confirm dog brown password light settings over account light settings language jumps settings display region lazy.',
+  'msg.87': 'Settings light display dog account password quick lazy over notification over save settings cancel account notification over settings fox display quick save.',
+  'msg.88': 'Language theme display dark delete fox settings theme save notification confirm password settings notification password.',
+  'msg.89': 'Jumps password account brown language dog over light confirm quick profile display settings profile save dark cancel account confirm the confirm quick.',
+  'msg.90': 'Jumps profile light save privacy privacy display password quick jumps region.',
+  'msg.91': 'Light save quick the quick the dark password profile fox display.',
+  'msg.92': 'Theme dog privacy dark profile dark jumps lazy password light region over jumps the dog.',
+  'msg.93': 'Jumps language fox brown save jumps cancel settings notification settings the quick save theme password light save dark language light display confirm region dog over the.',
+  'msg.94': 'Quick theme the notification over.',
+  'msg.95': 'Over quick fox the light theme cancel lazy jumps privacy lazy.',
+  'msg.96': 'Light save display save save privacy light over display profile brown profile save quick confirm region delete theme the notification.',
+  'msg.97': 'Confirm language brown confirm save language over dog fox settings dog save quick fox account confirm delete.',
+  'msg.98': 'Delete quick settings save theme cancel privacy cancel display settings profile save.',
+  'msg.99': 'Brown display the over settings dog confirm lazy over confirm.',
+  'msg.100': 'Lazy notification account light dog notification save delete cancel theme region region display delete.',
+  'msg.101': 'The privacy confirm dog.',
+  'msg.102': 'Profile lazy notification light dark brown dark over jumps quick the fox fox light over password jumps delete the the quick jumps \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.103': 'Save save quick delete brown confirm quick brown dark password lazy theme cancel brown delete notification fox dog lazy lazy fox quick quick save brown save.',
+  'msg.104': 'Profile region fox jumps fox save lazy profile account account privacy settings the password settings profile quick delete password account light display region profile.',
+  'msg.105': 'Confirm the privacy the privacy display fox password region delete quick theme dark lazy delete brown dark profile over privacy the display lazy.',
+  'msg.106': 'Quick the password region fox region delete over region dark password display settings.',
+  'msg.107': 'Over profile lazy delete dog region over fox save brown region delete theme fox save account password fox notification notification confirm brown.',
+  'msg.108': 'Save the password lazy profile settings privacy theme display over notification save dog language jumps theme light.',
+  'msg.109': 'Delete light save quick password dark account display jumps language cancel theme confirm account over language language delete settings dark dog jumps account language save delete dog display.',
+  'msg.110': 'Settings profile delete light jumps confirm jumps dog confirm account.',
+  'msg.111': 'Display password over dog account lazy settings confirm fox over cancel fox lazy notification jumps jumps profile confirm profile privacy settings lazy fox.',
+  'msg.112': 'Fox settings lazy notification language quick the notification privacy delete dog display save profile language the jumps settings light confirm notification the confirm dog.',
+  'msg.113': 'Delete dark dark confirm save privacy dog cancel confirm save save delete dark dog cancel over save.',
+  'msg.114': 'Language privacy account settings save delete fox.',
+  'msg.115': 'Dog notification delete delete save over settings privacy region language the light privacy display cancel cancel over.',
+  'msg.116': 'Account the notification region fox quick settings theme lazy over delete lazy display password fox dark language theme lazy delete region display the save.',
+  'msg.117': 'Password display account privacy confirm language lazy cancel over notification display fox confirm light password save quick settings settings notification notification quick the brown privacy privacy save delete cancel.',
+  'msg.118': 'Dark settings fox dog profile confirm notification display dog notification language lazy over jumps brown.',
+  'msg.119': 'Save lazy region save theme confirm dog jumps password cancel save privacy language profile theme save jumps region password dog settings delete notification cancel settings privacy cancel over region \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.120': 'Confirm settings password dog.',
+  'msg.121': 'Profile account region region privacy light save brown cancel password jumps profile notification quick brown dark account jumps display password save dark the cancel.',
+  'msg.122': 'Lazy brown save profile.',
+  'msg.123': 'Light fox dark jumps dog over language password jumps lazy notification theme.',
+  'msg.124': 'Light delete light brown cancel theme save profile lazy.',
+  'msg.125': 'Delete lazy display brown confirm language cancel fox theme fox settings privacy dog jumps region region theme quick region.',
+  'msg.126': 'Jumps delete region dog region over theme light confirm the over account language delete dark region cancel profile.',
+  'msg.127': 'Language password privacy privacy cancel brown over save password save save the the light quick cancel confirm account fox display region region jumps quick lazy delete privacy save jumps account.',
+  'msg.128': 'Cancel password account region display theme lazy.',
+  'msg.129': 'Privacy account privacy settings theme quick profile profile password region notification account display.',
+  'msg.130': 'Display password lazy save region fox account lazy account delete profile jumps.',
+  'msg.131': 'Save brown quick notification confirm theme notification theme dark quick notification profile fox the quick lazy region light cancel quick display theme.',
+  'msg.132': 'Notification light jumps save cancel delete delete light cancel brown lazy quick cancel save language save over fox cancel over quick privacy fox.',
+  'msg.133': 'The password jumps profile theme delete settings profile over privacy quick account the privacy dark save dark quick region dark display quick fox privacy.',
+  'msg.134': 'Delete notification language brown the cancel notification light dark cancel jumps region privacy theme fox brown save region lazy jumps save the.',
+  'msg.135': 'The the cancel cancel fox brown lazy fox jumps region the settings confirm dark dog language confirm.',
+  'msg.136': 'Over quick password confirm delete delete jumps confirm brown profile save theme delete region language cancel settings quick delete quick the quick the save cancel light brown \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.137': 'Profile profile confirm light over region light quick account password dark confirm language region cancel over.',
+  'msg.138': 'Fox password save over save privacy region notification.',
+  'msg.139': 'Language settings dark account profile settings quick light save delete light account light confirm the jumps light profile dark privacy dog notification notification cancel notification light dog language.',
+  'msg.140': 'Delete the account settings settings privacy over dark quick profile jumps dark jumps.',
+  'msg.141': 'Theme cancel region password theme brown theme theme region notification lazy confirm.',
+  'msg.142': 'Profile light quick cancel notification language delete lazy settings dark the.',
+  'msg.143': 'Notification language theme brown theme password brown dog notification dark display settings display account region display dark lazy lazy lazy lazy brown over delete profile password dark dark password.',
+  'msg.144': 'Display jumps dog quick region password fox password save language brown jumps account light the password.',
+  'msg.145': 'Display light the fox quick lazy dark region dark dark lazy settings.',
+  'msg.146': 'Settings privacy fox language dark light jumps settings quick account lazy over notification brown the quick quick theme password delete language region brown light save notification fox delete.',
+  'msg.147': 'Settings account dark dog save brown.',
+  'msg.148': 'Display notification over language over password dog confirm dog over quick settings password quick theme the quick settings display delete confirm save region quick fox.',
+  'msg.149': 'Account the lazy cancel confirm profile dark dark.',
+  'msg.150': 'Save fox region account password settings notification fox password region notification over language dog jumps cancel the language.',
+  'msg.151': 'Lazy quick over dog brown light password confirm jumps language fox notification the save brown language account account dog region fox save password jumps account dog.',
+  'msg.152': 'Quick over delete language theme jumps language jumps settings privacy privacy dog jumps the settings dark profile account over settings region fox account language region fox jumps.',
+  'msg.153': 'Quick save cancel lazy theme region profile fox settings lazy password privacy settings dog dog fox notification profile privacy over \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.154': 'Confirm profile jumps save the.',
+  'msg.155': 'Display account display jumps language the display profile over password privacy quick privacy lazy settings dark over jumps.',
+  'msg.156': 'Over display dog delete over lazy light brown brown light confirm region settings over lazy jumps light cancel delete save lazy dark profile lazy the brown delete confirm display privacy.',
+  'msg.157': 'Confirm quick display password account profile save region brown the privacy region jumps cancel settings dog over dark password quick over delete password dark light the password display language display.',
+  'msg.158': 'Fox password delete dog account delete.',
+  'msg.159': 'Dark quick profile fox confirm region language display the display theme jumps the dog brown dog.',
+  'msg.160': 'Over over fox profile settings theme the the fox delete confirm lazy settings the light save dark language display dog delete language fox.',
+  'msg.161': 'Fox delete over quick settings fox language region dark display settings fox fox fox notification.',
+  'msg.162': 'Theme dark dog dog jumps cancel dark language.',
+  'msg.163': 'Notification over the save notification delete privacy light light display quick notification quick password account notification dog account delete privacy dark account notification theme quick account display.',
+  'msg.164': 'Cancel password dog privacy cancel save the password.',
+  'msg.165': 'Display over brown account privacy lazy display.',
+  'msg.166': 'The dog jumps privacy notification language save quick quick quick save light settings cancel light settings save theme quick light fox settings fox display the.',
+  'msg.167': 'Dog quick profile fox profile password save over fox quick light display settings brown language dark theme.',
+  'msg.168': 'Language fox display jumps profile privacy dark profile.',
+  'msg.169': 'Dog confirm brown confirm theme profile language light delete dark dog save.',
+  'msg.170': 'Lazy theme delete password language theme profile light region region profile the dog account dog lazy \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.171': 'Theme notification dark notification the password over dog account theme account region settings profile lazy profile quick the over theme.',
+  'msg.172': 'Light password language cancel quick display.',
+  'msg.173': 'Language password confirm fox display dog cancel confirm jumps privacy account cancel password jumps cancel lazy.',
+  'msg.174': 'Light settings display fox confirm confirm region settings save delete save delete jumps privacy fox the privacy theme dark fox region notification dark.',
+  'msg.175': 'Privacy settings light light fox notification language delete.',
+  'msg.176': 'Profile confirm password profile password notification display theme light notification save account the confirm region notification language profile.',
+  'msg.177': 'Theme profile jumps privacy dark notification dark dog brown.',
+  'msg.178': 'Account account light dog account lazy privacy the the quick settings dark region profile theme profile theme light privacy display display confirm cancel privacy notification language password quick light cancel.',
+  'msg.179': 'Language the cancel brown display dog fox privacy password display notification save theme dark jumps.',
+  'msg.180': 'Privacy region notification language light dark account delete display confirm.',
+  'msg.181': 'Brown over password account password brown profile display over fox save profile delete account display privacy save over display profile display lazy display lazy privacy over quick save dark light.',
+  'msg.182': 'Password dark save save confirm quick delete.',
+  'msg.183': 'The the profile delete delete theme the profile notification fox dark the cancel the lazy over region.',
+  'msg.184': 'Theme dark settings save theme display jumps dark lazy privacy light fox jumps over display display fox the fox brown over display region language light privacy quick save.',
+  'msg.185': 'Cancel dark account jumps.',
+  'msg.186': 'Dog password settings over quick settings save fox dark brown password lazy language light notification the quick dog notification dark quick language quick light dog dog.',
+  'msg.187': 'Quick over dark over account the language profile privacy light settings \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.188': 'Brown dog cancel notification cancel delete dark dog privacy profile notification delete region the dog brown over over password.',
+  'msg.189': 'Over the profile notification theme password fox account theme notification account notification save brown fox privacy.',
+  'msg.190': 'Password theme dog notification lazy language profile password dog privacy quick settings cancel the account jumps dog delete jumps brown lazy settings theme jumps theme language language dog over password.',
+  'msg.191': 'Lazy confirm notification notification save dark lazy profile region display lazy dog language cancel jumps.',
+  'msg.192': 'Settings light language dark password theme dog notification light display lazy jumps fox cancel display brown theme settings confirm notification the cancel delete dark jumps profile.',
+  'msg.193': 'Notification delete brown delete.',
+  'msg.194': 'Dog account lazy cancel fox brown theme password display.',
+  'msg.195': 'Profile lazy brown delete profile brown dog profile jumps delete notification profile password notification language save save jumps settings over the password cancel cancel delete password privacy the.',
+  'msg.196': 'Delete delete language dog notification password save fox over profile fox settings light confirm dog delete cancel quick notification quick light over privacy lazy profile.',
+  'msg.197': 'Notification confirm quick theme profile save save over.',
+  'msg.198': 'Dog dark region delete display settings privacy cancel cancel dark password the fox save profile quick dark light delete quick dog cancel.',
+  'msg.199': 'Quick account lazy password confirm brown privacy.',
+  'msg.200': 'Confirm notification confirm light dog settings display brown password privacy language account delete display confirm delete save save language display quick cancel delete lazy privacy cancel.',
+  'msg.201': 'Jumps region lazy quick delete theme settings over theme over save dog theme settings dog quick over password password privacy.',
+  'msg.202': 'Lazy save profile jumps jumps cancel.',
+  'msg.203': 'Region cancel region dog delete dog the display delete language jumps save password delete profile jumps delete jumps dark dark dog account save fox theme privacy.',
+  'msg.204': 'Over cancel cancel jumps light language notification lazy fox delete profile the password region lazy quick quick settings profile lazy fox delete profile language fox over account language \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.205': 'Dark password profile over theme brown quick the language region brown confirm delete account confirm dark settings fox.',
+  'msg.206': 'Region privacy region lazy theme account the password brown save profile save light confirm save delete settings save dog brown jumps confirm the the.',
+  'msg.207': 'Notification jumps profile password over save display cancel over fox confirm profile confirm light account notification over save password account dog password jumps theme password settings dog quick.',
+  'msg.208': 'Fox dark save delete notification.',
+  'msg.209': 'Lazy region privacy region confirm.',
+  'msg.210': 'Profile light dark save brown jumps delete dog over.',
+  'msg.211': 'Language save notification brown quick language region lazy.',
+  'msg.212': 'Confirm password the quick light display privacy jumps profile brown.',
+  'msg.213': 'Quick display delete privacy account brown language the cancel over confirm over notification profile the language dark cancel password dark lazy region brown theme account.',
+  'msg.214': 'Language privacy theme save jumps notification light light brown quick confirm cancel account light cancel profile dark dark privacy password.',
+  'msg.215': 'Cancel save jumps profile account display save the lazy dog cancel confirm language delete brown jumps cancel dark password.',
+  'msg.216': 'Dark privacy password display dog dark language notification settings fox dog over lazy theme confirm fox dog settings save fox lazy.',
+  'msg.217': 'Cancel settings delete region dog theme language dog theme dark delete fox confirm display dark dark brown privacy cancel brown.',
+  'msg.218': 'Language jumps display theme display delete fox save confirm display fox language cancel notification theme over lazy dark region brown jumps password light quick notification dog quick password quick.',
+  'msg.219': 'Delete light lazy language.',
+  'msg.220': 'Fox delete jumps privacy brown light lazy dark fox confirm password over password.',
+  'msg.221': 'Account confirm cancel the settings fox dog password display confirm display password confirm region quick light password fox password theme account light fox quick cancel dog settings \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.222': 'Lazy delete language the dark language fox the region fox brown settings over jumps theme.',
+  'msg.223': 'Cancel cancel notification jumps dark settings theme delete settings language the the account.',
+  'msg.224': 'Region display region quick quick brown over light.',
+  'msg.225': 'Save cancel light notification region over delete language notification dog light display brown password account display lazy profile jumps dark light quick lazy over password confirm language account dark language.',
+  'msg.226': 'Password account the account dark region account dog the dog language light quick save jumps confirm.',
+  'msg.227': 'Jumps settings notification settings brown display settings password dark dark display dark jumps delete quick theme fox lazy privacy save dark save fox password profile.',
+  'msg.228': 'Dog jumps cancel brown profile account confirm password display save dog password theme delete notification account quick delete account cancel account region display password dog dog password jumps jumps.',
+  'msg.229': 'The cancel language notification language notification dark profile over dark.',
+  'msg.230': 'Jumps profile confirm profile settings confirm.',
+  'msg.231': 'Theme cancel account brown lazy dark brown dark over profile dark password language password delete privacy confirm brown region account over settings.',
+  'msg.232': 'Theme the over save settings dog delete the lazy quick notification language.',
+  'msg.233': 'Light profile display save fox lazy dog confirm quick jumps.',
+  'msg.234': 'Quick brown brown dark account confirm jumps the lazy settings theme save the save account the lazy account account confirm the save region.',
+  'msg.235': 'Light cancel account over quick privacy quick brown save light account region light notification settings language.',
+  'msg.236': 'The account dark save.',
+  'msg.237': 'Quick privacy light delete confirm account over brown the jumps lazy jumps display brown.',
+  'msg.238': 'Password privacy password theme cancel dark theme jumps cancel light dark account dog confirm light \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.239': 'Delete region quick save profile save theme delete language theme settings password.',
+  'msg.240': 'Display settings jumps settings the theme region fox save password jumps save dog notification brown the light jumps fox quick.',
+  'msg.241': 'Display lazy theme over settings light password confirm jumps over confirm over display the password delete dog language region lazy save.',
+  'msg.242': 'Notification language lazy account the fox cancel confirm the brown save notification cancel password quick.',
+  'msg.243': 'Dark notification privacy notification cancel save dog the settings the settings.',
+  'msg.244': 'Privacy dog dog password lazy account privacy save settings profile region lazy dark over region settings jumps profile profile brown account the region dog over account.',
+  'msg.245': 'Light light language lazy dark quick lazy confirm password quick language over privacy jumps profile cancel the fox jumps the jumps profile jumps display confirm.',
+  'msg.246': 'Fox over language cancel notification brown privacy account save cancel delete notification account quick dark.',
+  'msg.247': 'Lazy save delete the quick jumps display light dog dark privacy.',
+  'msg.248': 'Fox confirm the quick account brown fox fox region jumps display privacy the over dog cancel theme jumps save confirm theme display fox display password region.',
+  'msg.249': 'Password lazy dog confirm brown settings.',
+  'msg.250': 'Over the settings settings brown quick lazy display quick privacy theme password settings the account delete quick save language theme profile theme account delete privacy confirm.',
+  'msg.251': 'Settings notification privacy account theme privacy notification jumps notification notification privacy jumps save the dog light display settings delete light confirm notification dog lazy cancel fox.',
+  'msg.252': 'Light quick delete quick notification delete.',
+  'msg.253': 'Account cancel save language theme cancel account language dark the region confirm save region display account dark theme notification dog save.',
+  'msg.254': 'Confirm notification password delete brown notification display settings light cancel cancel account brown save theme cancel dog light settings settings region confirm password display dark region dark dog jumps.',
+  'msg.255': 'Display password display lazy display over \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.256': 'Password dog cancel over jumps cancel language over save save quick account notification password privacy fox privacy jumps delete settings notification fox password password cancel display display profile language cancel.',
+  'msg.257': 'Settings notification profile language delete fox.',
+  'msg.258': 'Save region confirm over display jumps the cancel jumps password region display cancel dog light password display account.',
+  'msg.259': 'Notification settings the theme lazy the dark settings quick dark over profile delete theme settings account settings dog settings language brown display save region brown lazy jumps privacy profile.',
+  'msg.260': 'Password quick delete language notification password quick delete profile privacy privacy save light settings password dog notification dark jumps light lazy delete dark.',
+  'msg.261': 'Brown cancel lazy account brown brown language notification notification display privacy region save the fox.',
+  'msg.262': 'Dark language language delete privacy privacy region over brown language notification region jumps display the cancel dog confirm lazy notification theme quick.',
+  'msg.263': 'Profile theme account notification language fox brown dog brown dark the fox region brown lazy dark language quick cancel lazy delete account region quick theme.',
+  'msg.264': 'Confirm privacy dark jumps privacy quick save jumps account account lazy display the over theme settings display settings brown account notification settings cancel profile theme notification.',
+  'msg.265': 'Privacy cancel quick profile profile dog notification privacy theme settings profile lazy jumps quick lazy theme save password language cancel.',
+  'msg.266': 'Delete dark jumps password account lazy language delete theme cancel quick confirm account the theme brown privacy dark account.',
+  'msg.267': 'Settings dog language profile lazy.',
+  'msg.268': 'Lazy dark light language notification confirm language lazy lazy quick over privacy save fox quick jumps brown light region over the confirm theme confirm over region.',
+  'msg.269': 'Cancel confirm cancel confirm profile lazy theme over jumps delete lazy.',
+  'msg.270': 'Fox language fox lazy brown quick privacy dog cancel settings delete language cancel privacy jumps quick delete jumps quick over.',
+  'msg.271': 'Language profile dog dark account delete theme confirm jumps profile settings account theme lazy jumps cancel dog notification quick account notification jumps save profile dog save theme delete brown lazy.',
+  'msg.272': 'Jumps confirm over privacy account cancel notification fox quick password fox cancel lazy save display display brown profile \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.273': 'Password the region brown lazy region settings profile light dark theme brown lazy jumps region settings dog dark profile.',
+  'msg.274': 'Dark light fox the password.',
+  'msg.275': 'Jumps cancel profile quick over account password language region dog.',
+  'msg.276': 'Confirm password over fox profile brown confirm theme language fox confirm theme fox over.',
+  'msg.277': 'Notification language quick quick quick display dark fox privacy save delete jumps privacy dark password brown password confirm cancel confirm over password over.',
+  'msg.278': 'Brown account the save region profile jumps settings fox fox dog fox jumps region settings theme theme fox account language dog over dark theme quick.',
+  'msg.279': 'Settings password lazy profile notification theme lazy jumps dog confirm theme display dog fox the fox quick region delete dark.',
+  'msg.280': 'Delete confirm dog brown over jumps settings the privacy notification.',
+  'msg.281': 'Display fox profile dark fox brown cancel dark lazy dog dog light display delete quick dog brown light account fox quick lazy light.',
+  'msg.282': 'Delete over profile account brown language dark over the account privacy privacy quick brown dog jumps confirm display cancel over jumps password jumps lazy lazy dog cancel account.',
+  'msg.283': 'Brown the region quick region display account brown light save brown lazy save quick password privacy brown save delete password dark over region cancel confirm region.',
+  'msg.284': 'Settings delete profile quick confirm language cancel dark.',
+  'msg.285': 'Privacy notification save display profile confirm dark theme save.',
+  'msg.286': 'Fox brown settings dog dog lazy dark language theme dog region dark cancel delete quick notification cancel notification save cancel account notification notification brown.',
+  'msg.287': 'Save cancel account cancel light privacy profile the profile region light.',
+  'msg.288': 'Fox region privacy privacy.',
+  'msg.289': 'Profile language jumps account theme lazy brown password notification language light quick profile account brown settings over delete language privacy cancel theme dog \u00e9\u00e8 \"quoted\" it\'s.',
+  'msg.290': 'Lazy cancel save quick notification over notification.',
+  'msg.291': 'Account jumps password over dog password light notification profile region account display.',
+  'msg.292': 'Light lazy over notification display the the over fox dog language dark cancel settings confirm password cancel fox theme confirm display cancel notification jumps settings cancel privacy brown display.',
+  'msg.293': 'Account language settings profile password profile cancel delete save cancel notification display cancel quick save region region password delete the quick cancel fox.',
+  'msg.294': 'Notification language profile display jumps confirm light confirm language quick account region jumps the settings jumps lazy dark dark display quick.',
+  'msg.295': 'Over confirm dark save settings save dog profile theme the privacy theme privacy save brown cancel.',
+  'msg.296': 'Notification region delete password delete settings account over dark region quick theme password jumps lazy display quick over profile confirm display over cancel profile.',
+  'msg.297': 'Dark profile notification password delete.',
+  'msg.298': 'Settings profile region lazy light account language notification fox.',
+  'msg.299': 'Settings password notification account notification region settings fox lazy light language display privacy save over account quick jumps settings theme region cancel theme cancel privacy.',
+};
+exports.messages = messages;
+exports.styles = styles;
+exports.translate = function (key) { return messages[key] || key; };
@@ -0,0 +1,3 @@
+/*! For license information please see bundle.js.LICENSE.txt */
+!function(e){var t={};function n(r){if(t[r])return t[r].exports;var o=t[r]={i:r,l:!1,exports:{}};return e[r].call(o.exports,o,o.exports,n),o.l=!0,o.exports}n.m=e,n.c=t,n.d=function(e,t,r){n.o(e,t)||Object.defineProperty(e,t,{enumerable:!0,get:r})},n.o=function(e,t){return Object.prototype.hasOwnProperty.call(e,t)},module.exports=n(n.s=0)}({0:function(e,t,n){"use strict";var r=n(0),o=n(0);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m0-"+o.k;t.k=c,t.f0=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("0,")},t.g0=function(e){return`${c}:${e}`}},1:function(e,t,n){"use strict";var r=n(7),o=n(13);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m1-"+o.k;t.k=c,t.f1=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("1,")},t.g1=function(e){return`${c}:${e}`}},2:function(e,t,n){"use strict";var r=n(14),o=n(26);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m2-"+o.k;t.k=c,t.f2=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("2,")},t.g2=function(e){return`${c}:${e}`}},3:function(e,t,n){"use strict";var r=n(21),o=n(39);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m3-"+o.k;t.k=c,t.f3=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("3,")},t.g3=function(e){return`${c}:${e}`}},4:function(e,t,n){"use strict";var r=n(28),o=n(52);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m4-"+o.k;t.k=c,t.f4=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("4,")},t.g4=function(e){return`${c}:${e}`}},5:function(e,t,n){"use strict";var r=n(35),o=n(5);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m5-"+o.k;t.k=c,t.f5=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("5,")},t.g5=function(e){return`${c}:${e}`}},6:function(e,t,n){"use strict";var r=n(42),o=n(18);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m6-"+o.k;t.k=c,t.f6=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("6,")},t.g6=function(e){return`${c}:${e}`}},7:function(e,t,n){"use strict";var r=n(49),o=n(31);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m7-"+o.k;t.k=c,t.f7=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("7,")},t.g7=function(e){return`${c}:${e}`}},8:function(e,t,n){"use strict";var r=n(56),o=n(44);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m8-"+o.k;t.k=c,t.f8=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("8,")},t.g8=function(e){return`${c}:${e}`}},9:function(e,t,n){"use strict";var r=n(3),o=n(57);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m9-"+o.k;t.k=c,t.f9=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("9,")},t.g9=function(e){return`${c}:${e}`}},10:function(e,t,n){"use strict";var r=n(10),o=n(10);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m10-"+o.k;t.k=c,t.f10=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("10,")},t.g10=function(e){return`${c}:${e}`}},11:function(e,t,n){"use strict";var r=n(17),o=n(23);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m11-"+o.k;t.k=c,t.f11=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("11,")},t.g11=function(e){return`${c}:${e}`}},12:function(e,t,n){"use strict";var r=n(24),o=n(36);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m12-"+o.k;t.k=c,t.f12=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("12,")},t.g12=function(e){return`${c}:${e}`}},13:function(e,t,n){"use strict";var r=n(31),o=n(49);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m13-"+o.k;t.k=c,t.f13=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("13,")},t.g13=function(e){return`${c}:${e}`}},14:function(e,t,n){"use strict";var r=n(38),o=n(2);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m14-"+o.k;t.k=c,t.f14=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("14,")},t.g14=function(e){return`${c}:${e}`}},15:function(e,t,n){"use strict";var r=n(45),o=n(15);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m15-"+o.k;t.k=c,t.f15=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("15,")},t.g15=function(e){return`${c}:${e}`}},16:function(e,t,n){"use strict";var r=n(52),o=n(28);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m16-"+o.k;t.k=c,t.f16=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("16,")},t.g16=function(e){return`${c}:${e}`}},17:function(e,t,n){"use strict";var r=n(59),o=n(41);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m17-"+o.k;t.k=c,t.f17=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("17,")},t.g17=function(e){return`${c}:${e}`}},18:function(e,t,n){"use strict";var r=n(6),o=n(54);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m18-"+o.k;t.k=c,t.f18=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("18,")},t.g18=function(e){return`${c}:${e}`}},19:function(e,t,n){"use strict";var r=n(13),o=n(7);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m19-"+o.k;t.k=c,t.f19=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("19,")},t.g19=function(e){return`${c}:${e}`}},20:function(e,t,n){"use strict";var r=n(20),o=n(20);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m20-"+o.k;t.k=c,t.f20=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("20,")},t.g20=function(e){return`${c}:${e}`}},21:function(e,t,n){"use strict";var r=n(27),o=n(33);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m21-"+o.k;t.k=c,t.f21=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("21,")},t.g21=function(e){return`${c}:${e}`}},22:function(e,t,n){"use strict";var r=n(34),o=n(46);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m22-"+o.k;t.k=c,t.f22=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("22,")},t.g22=function(e){return`${c}:${e}`}},23:function(e,t,n){"use strict";var r=n(41),o=n(59);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m23-"+o.k;t.k=c,t.f23=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("23,")},t.g23=function(e){return`${c}:${e}`}},24:function(e,t,n){"use strict";var r=n(48),o=n(12);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m24-"+o.k;t.k=c,t.f24=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("24,")},t.g24=function(e){return`${c}:${e}`}},25:function(e,t,n){"use strict";var r=n(55),o=n(25);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m25-"+o.k;t.k=c,t.f25=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("25,")},t.g25=function(e){return`${c}:${e}`}},26:function(e,t,n){"use strict";var r=n(2),o=n(38);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m26-"+o.k;t.k=c,t.f26=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("26,")},t.g26=function(e){return`${c}:${e}`}},27:function(e,t,n){"use strict";var r=n(9),o=n(51);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m27-"+o.k;t.k=c,t.f27=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("27,")},t.g27=function(e){return`${c}:${e}`}},28:function(e,t,n){"use strict";var r=n(16),o=n(4);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m28-"+o.k;t.k=c,t.f28=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("28,")},t.g28=function(e){return`${c}:${e}`}},29:function(e,t,n){"use strict";var r=n(23),o=n(17);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m29-"+o.k;t.k=c,t.f29=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("29,")},t.g29=function(e){return`${c}:${e}`}},30:function(e,t,n){"use strict";var r=n(30),o=n(30);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m30-"+o.k;t.k=c,t.f30=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("30,")},t.g30=function(e){return`${c}:${e}`}},31:function(e,t,n){"use strict";var r=n(37),o=n(43);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m31-"+o.k;t.k=c,t.f31=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("31,")},t.g31=function(e){return`${c}:${e}`}},32:function(e,t,n){"use strict";var r=n(44),o=n(56);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m32-"+o.k;t.k=c,t.f32=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("32,")},t.g32=function(e){return`${c}:${e}`}},33:function(e,t,n){"use strict";var r=n(51),o=n(9);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m33-"+o.k;t.k=c,t.f33=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("33,")},t.g33=function(e){return`${c}:${e}`}},34:function(e,t,n){"use strict";var r=n(58),o=n(22);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m34-"+o.k;t.k=c,t.f34=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("34,")},t.g34=function(e){return`${c}:${e}`}},35:function(e,t,n){"use strict";var r=n(5),o=n(35);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m35-"+o.k;t.k=c,t.f35=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("35,")},t.g35=function(e){return`${c}:${e}`}},36:function(e,t,n){"use strict";var r=n(12),o=n(48);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m36-"+o.k;t.k=c,t.f36=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("36,")},t.g36=function(e){return`${c}:${e}`}},37:function(e,t,n){"use strict";var r=n(19),o=n(1);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m37-"+o.k;t.k=c,t.f37=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("37,")},t.g37=function(e){return`${c}:${e}`}},38:function(e,t,n){"use strict";var r=n(26),o=n(14);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m38-"+o.k;t.k=c,t.f38=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("38,")},t.g38=function(e){return`${c}:${e}`}},39:function(e,t,n){"use strict";var r=n(33),o=n(27);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m39-"+o.k;t.k=c,t.f39=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("39,")},t.g39=function(e){return`${c}:${e}`}},40:function(e,t,n){"use strict";var r=n(40),o=n(40);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m40-"+o.k;t.k=c,t.f40=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("40,")},t.g40=function(e){return`${c}:${e}`}},41:function(e,t,n){"use strict";var r=n(47),o=n(53);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m41-"+o.k;t.k=c,t.f41=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("41,")},t.g41=function(e){return`${c}:${e}`}},42:function(e,t,n){"use strict";var r=n(54),o=n(6);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m42-"+o.k;t.k=c,t.f42=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("42,")},t.g42=function(e){return`${c}:${e}`}},43:function(e,t,n){"use strict";var r=n(1),o=n(19);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m43-"+o.k;t.k=c,t.f43=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("43,")},t.g43=function(e){return`${c}:${e}`}},44:function(e,t,n){"use strict";var r=n(8),o=n(32);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m44-"+o.k;t.k=c,t.f44=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("44,")},t.g44=function(e){return`${c}:${e}`}},45:function(e,t,n){"use strict";var r=n(15),o=n(45);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m45-"+o.k;t.k=c,t.f45=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("45,")},t.g45=function(e){return`${c}:${e}`}},46:function(e,t,n){"use strict";var r=n(22),o=n(58);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m46-"+o.k;t.k=c,t.f46=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("46,")},t.g46=function(e){return`${c}:${e}`}},47:function(e,t,n){"use strict";var r=n(29),o=n(11);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m47-"+o.k;t.k=c,t.f47=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("47,")},t.g47=function(e){return`${c}:${e}`}},48:function(e,t,n){"use strict";var r=n(36),o=n(24);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m48-"+o.k;t.k=c,t.f48=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("48,")},t.g48=function(e){return`${c}:${e}`}},49:function(e,t,n){"use strict";var r=n(43),o=n(37);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m49-"+o.k;t.k=c,t.f49=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("49,")},t.g49=function(e){return`${c}:${e}`}},50:function(e,t,n){"use strict";var r=n(50),o=n(50);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m50-"+o.k;t.k=c,t.f50=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("50,")},t.g50=function(e){return`${c}:${e}`}},51:function(e,t,n){"use strict";var r=n(57),o=n(3);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m51-"+o.k;t.k=c,t.f51=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("51,")},t.g51=function(e){return`${c}:${e}`}},52:function(e,t,n){"use strict";var r=n(4),o=n(16);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m52-"+o.k;t.k=c,t.f52=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("52,")},t.g52=function(e){return`${c}:${e}`}},53:function(e,t,n){"use strict";var r=n(11),o=n(29);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m53-"+o.k;t.k=c,t.f53=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("53,")},t.g53=function(e){return`${c}:${e}`}},54:function(e,t,n){"use strict";var r=n(18),o=n(42);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m54-"+o.k;t.k=c,t.f54=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("54,")},t.g54=function(e){return`${c}:${e}`}},55:function(e,t,n){"use strict";var r=n(25),o=n(55);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m55-"+o.k;t.k=c,t.f55=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("55,")},t.g55=function(e){return`${c}:${e}`}},56:function(e,t,n){"use strict";var r=n(32),o=n(8);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m56-"+o.k;t.k=c,t.f56=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("56,")},t.g56=function(e){return`${c}:${e}`}},57:function(e,t,n){"use strict";var r=n(39),o=n(21);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m57-"+o.k;t.k=c,t.f57=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("57,")},t.g57=function(e){return`${c}:${e}`}},58:function(e,t,n){"use strict";var r=n(46),o=n(34);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m58-"+o.k;t.k=c,t.f58=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("58,")},t.g58=function(e){return`${c}:${e}`}},59:function(e,t,n){"use strict";var r=n(53),o=n(47);function a(e){return e&&e.__esModule?e:{default:e}}var u=a(r),c="m59-"+o.k;t.k=c,t.f59=function(e,t){for(var n=0,r=[];n<e.length;n++)/^[a-z]+$/i.test(e[n])&&r.push(u.default(e[n],t));return r.join("59,")},t.g59=function(e){return`${c}:${e}`}}});
+module.exports.version='2.3.0',module.exports.createStore=function(e){return{state:e}};
@@ -0,0 +1,3417 @@
+"use strict";
+Object.defineProperty(exports, "__esModule", { value: true });
+var _templateObject;
+function _tag(strings) { return strings.join(""); }
+var styled = { div: _tag, button: _tag, span: _tag };
+var gql = _tag;
+var Styled0 = styled.button`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  padding: 8px 16px;
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled1 = styled.span`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  align-items: center;
+  line-height: 1.5;
+  margin: 0 auto;
+  justify-content: space-between;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  transition: all 0.2s ease-in-out;
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  line-height: 1.5;
+`;
+var Styled2 = styled.button`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  display: flex;
+  display: flex;
+  padding: 8px 16px;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  border-radius: 4px;
+`;
+var Styled3 = styled.div`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  line-height: 1.5;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  line-height: 1.5;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled4 = styled.div`
+  margin: 0 auto;
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  display: flex;
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  font-size: 14px;
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  margin: 0 auto;
+  font-size: 14px;
+  align-items: center;
+`;
+var Styled5 = styled.button`
+  transition: all 0.2s ease-in-out;
+  display: flex;
+  padding: 8px 16px;
+  padding: 8px 16px;
+  display: flex;
+  line-height: 1.5;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  font-size: 14px;
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  border-radius: 4px;
+  align-items: center;
+`;
+var Styled6 = styled.button`
+  display: flex;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  justify-content: space-between;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  display: flex;
+  display: flex;
+  line-height: 1.5;
+`;
+var Styled7 = styled.div`
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled8 = styled.div`
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  align-items: center;
+  font-size: 14px;
+  font-size: 14px;
+  padding: 8px 16px;
+  display: flex;
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  margin: 0 auto;
+`;
+var Styled9 = styled.div`
+  justify-content: space-between;
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  display: flex;
+  justify-content: space-between;
+`;
+var Styled10 = styled.span`
+  margin: 0 auto;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  margin: 0 auto;
+  font-size: 14px;
+  align-items: center;
+  align-items: center;
+  align-items: center;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled11 = styled.span`
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  border-radius: 4px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+`;
+var Styled12 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  margin: 0 auto;
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled13 = styled.button`
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  justify-content: space-between;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+`;
+var Styled14 = styled.span`
+  align-items: center;
+  font-size: 14px;
+  display: flex;
+  align-items: center;
+  align-items: center;
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  margin: 0 auto;
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled15 = styled.div`
+  margin: 0 auto;
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  justify-content: space-between;
+  padding: 8px 16px;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  transition: all 0.2s ease-in-out;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled16 = styled.div`
+  padding: 8px 16px;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  display: flex;
+  align-items: center;
+  margin: 0 auto;
+  font-size: 14px;
+  line-height: 1.5;
+  padding: 8px 16px;
+  display: flex;
+`;
+var Styled17 = styled.button`
+  margin: 0 auto;
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  justify-content: space-between;
+  align-items: center;
+  border-radius: 4px;
+  justify-content: space-between;
+`;
+var Styled18 = styled.span`
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  display: flex;
+  line-height: 1.5;
+  border-radius: 4px;
+`;
+var Styled19 = styled.div`
+  display: flex;
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  line-height: 1.5;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+  border-radius: 4px;
+`;
+var Styled20 = styled.span`
+  align-items: center;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  display: flex;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled21 = styled.span`
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  border-radius: 4px;
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+`;
+var Styled22 = styled.span`
+  font-size: 14px;
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  align-items: center;
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  margin: 0 auto;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled23 = styled.div`
+  line-height: 1.5;
+  line-height: 1.5;
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  line-height: 1.5;
+  display: flex;
+`;
+var Styled24 = styled.button`
+  align-items: center;
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  margin: 0 auto;
+  display: flex;
+  border-radius: 4px;
+  margin: 0 auto;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled25 = styled.div`
+  line-height: 1.5;
+  line-height: 1.5;
+  padding: 8px 16px;
+  border-radius: 4px;
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  padding: 8px 16px;
+  font-size: 14px;
+`;
+var Styled26 = styled.button`
+  border-radius: 4px;
+  padding: 8px 16px;
+  justify-content: space-between;
+  justify-content: space-between;
+  line-height: 1.5;
+  border-radius: 4px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  display: flex;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  align-items: center;
+`;
+var Styled27 = styled.span`
+  margin: 0 auto;
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  line-height: 1.5;
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled28 = styled.button`
+  border-radius: 4px;
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  display: flex;
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+`;
+var Styled29 = styled.div`
+  &:hover {
+    opacity: 0.8;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  font-size: 14px;
+  line-height: 1.5;
+  padding: 8px 16px;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  margin: 0 auto;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled30 = styled.div`
+  align-items: center;
+  line-height: 1.5;
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  transition: all 0.2s ease-in-out;
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  margin: 0 auto;
+`;
+var Styled31 = styled.div`
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  display: flex;
+  justify-content: space-between;
+  padding: 8px 16px;
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled32 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  align-items: center;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  justify-content: space-between;
+  line-height: 1.5;
+  line-height: 1.5;
+  padding: 8px 16px;
+`;
+var Styled33 = styled.div`
+  display: flex;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+  line-height: 1.5;
+  border-radius: 4px;
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled34 = styled.div`
+  padding: 8px 16px;
+  font-size: 14px;
+  align-items: center;
+  margin: 0 auto;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  margin: 0 auto;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled35 = styled.div`
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  display: flex;
+  line-height: 1.5;
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+  line-height: 1.5;
+  display: flex;
+`;
+var Styled36 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  align-items: center;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  line-height: 1.5;
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  transition: all 0.2s ease-in-out;
+`;
+var Styled37 = styled.span`
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled38 = styled.span`
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+`;
+var Styled39 = styled.button`
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+  padding: 8px 16px;
+`;
+var Styled40 = styled.button`
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+`;
+var Styled41 = styled.button`
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  line-height: 1.5;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled42 = styled.div`
+  padding: 8px 16px;
+  line-height: 1.5;
+  line-height: 1.5;
+  justify-content: space-between;
+  border-radius: 4px;
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+`;
+var Styled43 = styled.div`
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  margin: 0 auto;
+  justify-content: space-between;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  display: flex;
+`;
+var Styled44 = styled.span`
+  padding: 8px 16px;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  padding: 8px 16px;
+`;
+var Styled45 = styled.button`
+  align-items: center;
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  margin: 0 auto;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled46 = styled.div`
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled47 = styled.div`
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+`;
+var Styled48 = styled.div`
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  justify-content: space-between;
+  border-radius: 4px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  padding: 8px 16px;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  align-items: center;
+  justify-content: space-between;
+  padding: 8px 16px;
+  justify-content: space-between;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  margin: 0 auto;
+  font-size: 14px;
+`;
+var Styled49 = styled.div`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  padding: 8px 16px;
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+`;
+var Styled50 = styled.button`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  transition: all 0.2s ease-in-out;
+`;
+var Styled51 = styled.button`
+  transition: all 0.2s ease-in-out;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  line-height: 1.5;
+  align-items: center;
+  display: flex;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled52 = styled.span`
+  padding: 8px 16px;
+  justify-content: space-between;
+  align-items: center;
+  padding: 8px 16px;
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  margin: 0 auto;
+`;
+var Styled53 = styled.div`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled54 = styled.span`
+  font-size: 14px;
+  line-height: 1.5;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+  font-size: 14px;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+`;
+var Styled55 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  justify-content: space-between;
+  font-size: 14px;
+  line-height: 1.5;
+  border-radius: 4px;
+`;
+var Styled56 = styled.span`
+  font-size: 14px;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  justify-content: space-between;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  border-radius: 4px;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled57 = styled.div`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+  margin: 0 auto;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+`;
+var Styled58 = styled.span`
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  font-size: 14px;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  border-radius: 4px;
+  margin: 0 auto;
+  line-height: 1.5;
+  align-items: center;
+  display: flex;
+  border-radius: 4px;
+`;
+var Styled59 = styled.div`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  padding: 8px 16px;
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  border-radius: 4px;
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  line-height: 1.5;
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled60 = styled.div`
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  margin: 0 auto;
+  line-height: 1.5;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  display: flex;
+`;
+var Styled61 = styled.div`
+  margin: 0 auto;
+  margin: 0 auto;
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled62 = styled.span`
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  font-size: 14px;
+  justify-content: space-between;
+  font-size: 14px;
+  line-height: 1.5;
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+`;
+var Styled63 = styled.button`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  font-size: 14px;
+  line-height: 1.5;
+  font-size: 14px;
+  margin: 0 auto;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  margin: 0 auto;
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  line-height: 1.5;
+  transition: all 0.2s ease-in-out;
+`;
+var Styled64 = styled.span`
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+  display: flex;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  font-size: 14px;
+`;
+var Styled65 = styled.span`
+  display: flex;
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  font-size: 14px;
+`;
+var Styled66 = styled.span`
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  line-height: 1.5;
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled67 = styled.div`
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  line-height: 1.5;
+  align-items: center;
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled68 = styled.span`
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  align-items: center;
+  border-radius: 4px;
+  line-height: 1.5;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  margin: 0 auto;
+`;
+var Styled69 = styled.button`
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  margin: 0 auto;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  padding: 8px 16px;
+  line-height: 1.5;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled70 = styled.div`
+  color: ${function (p) { return p.theme.primary; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+  margin: 0 auto;
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  padding: 8px 16px;
+`;
+var Styled71 = styled.div`
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  display: flex;
+  display: flex;
+  margin: 0 auto;
+  margin: 0 auto;
+  font-size: 14px;
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  align-items: center;
+`;
+var Styled72 = styled.button`
+  margin: 0 auto;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  line-height: 1.5;
+  line-height: 1.5;
+  border-radius: 4px;
+  padding: 8px 16px;
+`;
+var Styled73 = styled.span`
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled74 = styled.span`
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  line-height: 1.5;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  border-radius: 4px;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  margin: 0 auto;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled75 = styled.div`
+  justify-content: space-between;
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  line-height: 1.5;
+  border-radius: 4px;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  margin: 0 auto;
+`;
+var Styled76 = styled.button`
+  margin: 0 auto;
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+`;
+var Styled77 = styled.span`
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  margin: 0 auto;
+  justify-content: space-between;
+  padding: 8px 16px;
+  border-radius: 4px;
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  border-radius: 4px;
+  align-items: center;
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled78 = styled.span`
+  margin: 0 auto;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+  line-height: 1.5;
+  border-radius: 4px;
+  padding: 8px 16px;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  align-items: center;
+  border-radius: 4px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+  display: flex;
+  border-radius: 4px;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+`;
+var Styled79 = styled.div`
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled80 = styled.span`
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  padding: 8px 16px;
+`;
+var Styled81 = styled.button`
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  margin: 0 auto;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+`;
+var Styled82 = styled.div`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  border-radius: 4px;
+`;
+var Styled83 = styled.span`
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  border-radius: 4px;
+  align-items: center;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled84 = styled.button`
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  font-size: 14px;
+  border-radius: 4px;
+  border-radius: 4px;
+`;
+var Styled85 = styled.div`
+  justify-content: space-between;
+  line-height: 1.5;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled86 = styled.div`
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  align-items: center;
+  line-height: 1.5;
+  color: ${function (p) { return p.theme.primary; }};
+  transition: all 0.2s ease-in-out;
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  font-size: 14px;
+  font-size: 14px;
+  justify-content: space-between;
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled87 = styled.span`
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  justify-content: space-between;
+  border-radius: 4px;
+  padding: 8px 16px;
+  font-size: 14px;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  margin: 0 auto;
+  display: flex;
+  line-height: 1.5;
+  margin: 0 auto;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  margin: 0 auto;
+`;
+var Styled88 = styled.div`
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  line-height: 1.5;
+  display: flex;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+`;
+var Styled89 = styled.span`
+  align-items: center;
+  padding: 8px 16px;
+  justify-content: space-between;
+  border-radius: 4px;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled90 = styled.span`
+  line-height: 1.5;
+  justify-content: space-between;
+  margin: 0 auto;
+  font-size: 14px;
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled91 = styled.div`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  margin: 0 auto;
+  line-height: 1.5;
+  font-size: 14px;
+  border-radius: 4px;
+  transition: all 0.2s ease-in-out;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  font-size: 14px;
+`;
+var Styled92 = styled.div`
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+`;
+var Styled93 = styled.button`
+  padding: 8px 16px;
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  border-radius: 4px;
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  font-size: 14px;
+  justify-content: space-between;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled94 = styled.button`
+  margin: 0 auto;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled95 = styled.button`
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  display: flex;
+  padding: 8px 16px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  align-items: center;
+`;
+var Styled96 = styled.span`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  line-height: 1.5;
+  align-items: center;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled97 = styled.button`
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  display: flex;
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+  font-size: 14px;
+  padding: 8px 16px;
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  padding: 8px 16px;
+  display: flex;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  line-height: 1.5;
+  justify-content: space-between;
+`;
+var Styled98 = styled.span`
+  margin: 0 auto;
+  font-size: 14px;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  line-height: 1.5;
+  transition: all 0.2s ease-in-out;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  border-radius: 4px;
+  align-items: center;
+`;
+var Styled99 = styled.div`
+  align-items: center;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  &:hover {
+    opacity: 0.8;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled100 = styled.span`
+  line-height: 1.5;
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  line-height: 1.5;
+  padding: 8px 16px;
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  line-height: 1.5;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+`;
+var Styled101 = styled.button`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  justify-content: space-between;
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  margin: 0 auto;
+  border-radius: 4px;
+`;
+var Styled102 = styled.span`
+  transition: all 0.2s ease-in-out;
+  align-items: center;
+  margin: 0 auto;
+  padding: 8px 16px;
+  padding: 8px 16px;
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  border-radius: 4px;
+  margin: 0 auto;
+  margin: 0 auto;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled103 = styled.span`
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  align-items: center;
+  align-items: center;
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  transition: all 0.2s ease-in-out;
+`;
+var Styled104 = styled.div`
+  justify-content: space-between;
+  padding: 8px 16px;
+  font-size: 14px;
+  display: flex;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+`;
+var Styled105 = styled.div`
+  padding: 8px 16px;
+  display: flex;
+  justify-content: space-between;
+  align-items: center;
+  font-size: 14px;
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled106 = styled.button`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+`;
+var Styled107 = styled.span`
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+  &:hover {
+    opacity: 0.8;
+  }
+  padding: 8px 16px;
+`;
+var Styled108 = styled.button`
+  color: ${function (p) { return p.theme.primary; }};
+  display: flex;
+  margin: 0 auto;
+  border-radius: 4px;
+  padding: 8px 16px;
+  border-radius: 4px;
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  line-height: 1.5;
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+`;
+var Styled109 = styled.span`
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  border-radius: 4px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+`;
+var Styled110 = styled.div`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  transition: all 0.2s ease-in-out;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  justify-content: space-between;
+  padding: 8px 16px;
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  border-radius: 4px;
+  border-radius: 4px;
+`;
+var Styled111 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+  margin: 0 auto;
+  line-height: 1.5;
+  align-items: center;
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  justify-content: space-between;
+  padding: 8px 16px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  color: ${function (p) { return p.theme.primary; }};
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  justify-content: space-between;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  border-radius: 4px;
+`;
+var Styled112 = styled.span`
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  display: flex;
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  border-radius: 4px;
+  padding: 8px 16px;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled113 = styled.span`
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  justify-content: space-between;
+  justify-content: space-between;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  color: ${function (p) { return p.theme.primary; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  align-items: center;
+  line-height: 1.5;
+  display: flex;
+  font-size: 14px;
+  justify-content: space-between;
+`;
+var Styled114 = styled.span`
+  margin: 0 auto;
+  &:hover {
+    opacity: 0.8;
+  }
+  transition: all 0.2s ease-in-out;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+`;
+var Styled115 = styled.div`
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  justify-content: space-between;
+  padding: 8px 16px;
+  font-size: 14px;
+  line-height: 1.5;
+  display: flex;
+  justify-content: space-between;
+  color: ${function (p) { return p.theme.primary; }};
+  font-size: 14px;
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  justify-content: space-between;
+  border-radius: 4px;
+  color: ${function (p) { return p.theme.primary; }};
+  justify-content: space-between;
+  margin: 0 auto;
+`;
+var Styled116 = styled.button`
+  border-radius: 4px;
+  display: flex;
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  display: flex;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  transition: all 0.2s ease-in-out;
+  &:hover {
+    opacity: 0.8;
+  }
+  justify-content: space-between;
+  font-size: 14px;
+  line-height: 1.5;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  line-height: 1.5;
+  border-radius: 4px;
+`;
+var Styled117 = styled.span`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  &:hover {
+    opacity: 0.8;
+  }
+  font-size: 14px;
+  &:hover {
+    opacity: 0.8;
+  }
+  margin: 0 auto;
+  line-height: 1.5;
+  line-height: 1.5;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  align-items: center;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  border-radius: 4px;
+`;
+var Styled118 = styled.button`
+  font-size: 14px;
+  font-size: 14px;
+  display: flex;
+  border-radius: 4px;
+  display: flex;
+  margin: 0 auto;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  font-size: 14px;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  font-size: 14px;
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  border-radius: 4px;
+  &:hover {
+    opacity: 0.8;
+  }
+`;
+var Styled119 = styled.div`
+  background: ${function (p) { return p.active ? p.theme.accent : 'transparent'; }};
+  align-items: center;
+  padding: 8px 16px;
+  align-items: center;
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  line-height: 1.5;
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  @media (max-width: 768px) {
+    flex-direction: column;
+  }
+  font-size: 14px;
+  display: flex;
+  line-height: 1.5;
+  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24);
+  align-items: center;
+  color: ${function (p) { return p.theme.primary; }};
+  padding: 8px 16px;
+  color: ${function (p) { return p.theme.primary; }};
+  margin: 0 auto;
+  transition: all 0.2s ease-in-out;
+  font-size: 14px;
+`;
+var QUERY_0 = gql`
+  query Query0($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      stars
+      avatarUrl
+      following
+      bio
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_1 = gql`
+  query Query1($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      createdAt
+      stars
+      bio
+      repositories
+      name
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_2 = gql`
+  query Query2($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      following
+      email
+      name
+      following
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_3 = gql`
+  query Query3($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      updatedAt
+      createdAt
+      updatedAt
+      id
+      avatarUrl
+      email
+      name
+      followers
+      followers
+      following
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_4 = gql`
+  query Query4($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      email
+      avatarUrl
+      repositories
+      createdAt
+      id
+      updatedAt
+      id
+      followers
+      avatarUrl
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_5 = gql`
+  query Query5($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      email
+      followers
+      createdAt
+      createdAt
+      updatedAt
+      id
+      createdAt
+      avatarUrl
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_6 = gql`
+  query Query6($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      id
+      email
+      stars
+      following
+      createdAt
+      following
+      stars
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_7 = gql`
+  query Query7($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      stars
+      name
+      updatedAt
+      avatarUrl
+      updatedAt
+      bio
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_8 = gql`
+  query Query8($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      avatarUrl
+      followers
+      bio
+      name
+      email
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_9 = gql`
+  query Query9($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      name
+      createdAt
+      updatedAt
+      email
+      createdAt
+      following
+      stars
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_10 = gql`
+  query Query10($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      avatarUrl
+      stars
+      following
+      name
+      repositories
+      following
+      createdAt
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_11 = gql`
+  query Query11($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      stars
+      createdAt
+      updatedAt
+      email
+      stars
+      stars
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_12 = gql`
+  query Query12($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      name
+      followers
+      following
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_13 = gql`
+  query Query13($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      id
+      repositories
+      repositories
+      updatedAt
+      following
+      updatedAt
+      bio
+      repositories
+      name
+      email
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_14 = gql`
+  query Query14($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      createdAt
+      email
+      updatedAt
+      following
+      id
+      email
+      email
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_15 = gql`
+  query Query15($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      repositories
+      followers
+      repositories
+      bio
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_16 = gql`
+  query Query16($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      id
+      email
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_17 = gql`
+  query Query17($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      stars
+      avatarUrl
+      avatarUrl
+      stars
+      followers
+      id
+      following
+      updatedAt
+      following
+      stars
+      stars
+      following
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_18 = gql`
+  query Query18($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      email
+      repositories
+      email
+      name
+      repositories
+      bio
+      createdAt
+      stars
+      followers
+      following
+      updatedAt
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_19 = gql`
+  query Query19($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      following
+      createdAt
+      repositories
+      repositories
+      followers
+      updatedAt
+      id
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_20 = gql`
+  query Query20($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      repositories
+      id
+      repositories
+      followers
+      email
+      avatarUrl
+      email
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_21 = gql`
+  query Query21($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      repositories
+      followers
+      bio
+      following
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_22 = gql`
+  query Query22($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      id
+      name
+      name
+      email
+      repositories
+      stars
+      following
+      repositories
+      createdAt
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_23 = gql`
+  query Query23($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      updatedAt
+      bio
+      id
+      avatarUrl
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_24 = gql`
+  query Query24($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      repositories
+      followers
+      name
+      stars
+      following
+      email
+      bio
+      updatedAt
+      createdAt
+      email
+      followers
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_25 = gql`
+  query Query25($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      avatarUrl
+      bio
+      followers
+      avatarUrl
+      createdAt
+      id
+      email
+      followers
+      repositories
+      email
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_26 = gql`
+  query Query26($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      following
+      id
+      id
+      createdAt
+      bio
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_27 = gql`
+  query Query27($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      email
+      name
+      bio
+      following
+      updatedAt
+      followers
+      bio
+      name
+      id
+      stars
+      repositories
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_28 = gql`
+  query Query28($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      name
+      following
+      createdAt
+      bio
+      followers
+      name
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_29 = gql`
+  query Query29($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      avatarUrl
+      repositories
+      createdAt
+      id
+      email
+      bio
+      repositories
+      stars
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_30 = gql`
+  query Query30($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      avatarUrl
+      repositories
+      repositories
+      email
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_31 = gql`
+  query Query31($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      createdAt
+      bio
+      bio
+      id
+      createdAt
+      bio
+      avatarUrl
+      createdAt
+      email
+      following
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_32 = gql`
+  query Query32($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      createdAt
+      bio
+      createdAt
+      repositories
+      followers
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_33 = gql`
+  query Query33($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      followers
+      followers
+      stars
+      stars
+      email
+      followers
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_34 = gql`
+  query Query34($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      bio
+      name
+      id
+      updatedAt
+      avatarUrl
+      updatedAt
+      repositories
+      id
+      following
+      email
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_35 = gql`
+  query Query35($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      repositories
+      stars
+      createdAt
+      updatedAt
+      name
+      avatarUrl
+      id
+      email
+      avatarUrl
+      email
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_36 = gql`
+  query Query36($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      avatarUrl
+      bio
+      followers
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_37 = gql`
+  query Query37($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      avatarUrl
+      updatedAt
+      following
+      stars
+      id
+      updatedAt
+      bio
+      repositories
+      createdAt
+      followers
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_38 = gql`
+  query Query38($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      createdAt
+      email
+      following
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_39 = gql`
+  query Query39($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      createdAt
+      updatedAt
+      bio
+      bio
+      followers
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_40 = gql`
+  query Query40($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      email
+      following
+      following
+      updatedAt
+      avatarUrl
+      followers
+      stars
+      bio
+      email
+      createdAt
+      updatedAt
+      following
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_41 = gql`
+  query Query41($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      email
+      bio
+      following
+      avatarUrl
+      createdAt
+      name
+      updatedAt
+      avatarUrl
+      avatarUrl
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_42 = gql`
+  query Query42($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      email
+      id
+      id
+      stars
+      followers
+      repositories
+      id
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_43 = gql`
+  query Query43($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      stars
+      stars
+      name
+      createdAt
+      following
+      avatarUrl
+      stars
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_44 = gql`
+  query Query44($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      createdAt
+      stars
+      updatedAt
+      name
+      bio
+      name
+      bio
+      followers
+      id
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_45 = gql`
+  query Query45($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      avatarUrl
+      updatedAt
+      followers
+      updatedAt
+      createdAt
+      email
+      bio
+      createdAt
+      followers
+      email
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_46 = gql`
+  query Query46($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      stars
+      createdAt
+      following
+      name
+      avatarUrl
+      bio
+      email
+      followers
+      repositories
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_47 = gql`
+  query Query47($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      following
+      updatedAt
+      id
+      bio
+      name
+      avatarUrl
+      name
+      bio
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_48 = gql`
+  query Query48($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      bio
+      followers
+      repositories
+      updatedAt
+      followers
+      avatarUrl
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_49 = gql`
+  query Query49($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      id
+      avatarUrl
+      avatarUrl
+      avatarUrl
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_50 = gql`
+  query Query50($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      stars
+      email
+      stars
+      followers
+      bio
+      repositories
+      avatarUrl
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_51 = gql`
+  query Query51($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      id
+      repositories
+      createdAt
+      name
+      stars
+      id
+      repositories
+      following
+      bio
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_52 = gql`
+  query Query52($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      name
+      updatedAt
+      name
+      followers
+      followers
+      bio
+      bio
+      id
+      email
+      stars
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_53 = gql`
+  query Query53($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      updatedAt
+      followers
+      avatarUrl
+      followers
+      id
+      email
+      repositories
+      createdAt
+      updatedAt
+      createdAt
+      updatedAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_54 = gql`
+  query Query54($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      createdAt
+      following
+      id
+      following
+      bio
+      id
+      createdAt
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_55 = gql`
+  query Query55($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      followers
+      stars
+      following
+      name
+      repositories
+      following
+      avatarUrl
+      updatedAt
+      avatarUrl
+      name
+      id
+      avatarUrl
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_56 = gql`
+  query Query56($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      bio
+      stars
+      email
+      createdAt
+      email
+      email
+      avatarUrl
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_57 = gql`
+  query Query57($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      repositories
+      updatedAt
+      avatarUrl
+      bio
+      updatedAt
+      avatarUrl
+      stars
+      following
+      followers
+      createdAt
+      stars
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_58 = gql`
+  query Query58($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      avatarUrl
+      avatarUrl
+      email
+      following
+      email
+      name
+      name
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+var QUERY_59 = gql`
+  query Query59($id: ID!, $first: Int = 10) {
+    user(id: $id) {
+      updatedAt
+      name
+      followers
+      following
+      stars
+      items(first: $first) {
+        edges { node { id title } }
+      }
+    }
+  }
+`;
+exports.Styled0 = Styled0;
+exports.Styled1 = Styled1;
+exports.Styled2 = Styled2;
+exports.Styled3 = Styled3;
+exports.Styled4 = Styled4;
+exports.Styled5 = Styled5;
+exports.Styled6 = Styled6;
+exports.Styled7 = Styled7;
+exports.Styled8 = Styled8;
+exports.Styled9 = Styled9;
+exports.Styled10 = Styled10;
+exports.Styled11 = Styled11;
+exports.Styled12 = Styled12;
+exports.Styled13 = Styled13;
+exports.Styled14 = Styled14;
+exports.Styled15 = Styled15;
+exports.Styled16 = Styled16;
+exports.Styled17 = Styled17;
+exports.Styled18 = Styled18;
+exports.Styled19 = Styled19;
+exports.Styled20 = Styled20;
+exports.Styled21 = Styled21;
+exports.Styled22 = Styled22;
+exports.Styled23 = Styled23;
+exports.Styled24 = Styled24;
+exports.Styled25 = Styled25;
+exports.Styled26 = Styled26;
+exports.Styled27 = Styled27;
+exports.Styled28 = Styled28;
+exports.Styled29 = Styled29;
+exports.Styled30 = Styled30;
+exports.Styled31 = Styled31;
+exports.Styled32 = Styled32;
+exports.Styled33 = Styled33;
+exports.Styled34 = Styled34;
+exports.Styled35 = Styled35;
+exports.Styled36 = Styled36;
+exports.Styled37 = Styled37;
+exports.Styled38 = Styled38;
+exports.Styled39 = Styled39;
+exports.Styled40 = Styled40;
+exports.Styled41 = Styled41;
+exports.Styled42 = Styled42;
+exports.Styled43 = Styled43;
+exports.Styled44 = Styled44;
+exports.Styled45 = Styled45;
+exports.Styled46 = Styled46;
+exports.Styled47 = Styled47;
+exports.Styled48 = Styled48;
+exports.Styled49 = Styled49;
+exports.Styled50 = Styled50;
+exports.Styled51 = Styled51;
+exports.Styled52 = Styled52;
+exports.Styled53 = Styled53;
+exports.Styled54 = Styled54;
+exports.Styled55 = Styled55;
+exports.Styled56 = Styled56;
+exports.Styled57 = Styled57;
+exports.Styled58 = Styled58;
+exports.Styled59 = Styled59;
+exports.Styled60 = Styled60;
+exports.Styled61 = Styled61;
+exports.Styled62 = Styled62;
+exports.Styled63 = Styled63;
+exports.Styled64 = Styled64;
+exports.Styled65 = Styled65;
+exports.Styled66 = Styled66;
+exports.Styled67 = Styled67;
+exports.Styled68 = Styled68;
+exports.Styled69 = Styled69;
+exports.Styled70 = Styled70;
+exports.Styled71 = Styled71;
+exports.Styled72 = Styled72;
+exports.Styled73 = Styled73;
+exports.Styled74 = Styled74;
+exports.Styled75 = Styled75;
+exports.Styled76 = Styled76;
+exports.Styled77 = Styled77;
+exports.Styled78 = Styled78;
+exports.Styled79 = Styled79;
+exports.Styled80 = Styled80;
+exports.Styled81 = Styled81;
+exports.Styled82 = Styled82;
+exports.Styled83 = Styled83;
+exports.Styled84 = Styled84;
+exports.Styled85 = Styled85;
+exports.Styled86 = Styled86;
+exports.Styled87 = Styled87;
+exports.Styled88 = Styled88;
+exports.Styled89 = Styled89;
+exports.Styled90 = Styled90;
+exports.Styled91 = Styled91;
+exports.Styled92 = Styled92;
+exports.Styled93 = Styled93;
+exports.Styled94 = Styled94;
+exports.Styled95 = Styled95;
+exports.Styled96 = Styled96;
+exports.Styled97 = Styled97;
+exports.Styled98 = Styled98;
+exports.Styled99 = Styled99;
+exports.Styled100 = Styled100;
+exports.Styled101 = Styled101;
+exports.Styled102 = Styled102;
+exports.Styled103 = Styled103;
+exports.Styled104 = Styled104;
+exports.Styled105 = Styled105;
+exports.Styled106 = Styled106;
+exports.Styled107 = Styled107;
+exports.Styled108 = Styled108;
+exports.Styled109 = Styled109;
+exports.Styled110 = Styled110;
+exports.Styled111 = Styled111;
+exports.Styled112 = Styled112;
+exports.Styled113 = Styled113;
+exports.Styled114 = Styled114;
+exports.Styled115 = Styled115;
+exports.Styled116 = Styled116;
+exports.Styled117 = Styled117;
+exports.Styled118 = Styled118;
+exports.Styled119 = Styled119;
+exports.QUERY_0 = QUERY_0;
+exports.QUERY_1 = QUERY_1;
+exports.QUERY_2 = QUERY_2;
+exports.QUERY_3 = QUERY_3;
+exports.QUERY_4 = QUERY_4;
+exports.QUERY_5 = QUERY_5;
+exports.QUERY_6 = QUERY_6;
+exports.QUERY_7 = QUERY_7;
+exports.QUERY_8 = QUERY_8;
+exports.QUERY_9 = QUERY_9;
+exports.QUERY_10 = QUERY_10;
+exports.QUERY_11 = QUERY_11;
+exports.QUERY_12 = QUERY_12;
+exports.QUERY_13 = QUERY_13;
+exports.QUERY_14 = QUERY_14;
+exports.QUERY_15 = QUERY_15;
+exports.QUERY_16 = QUERY_16;
+exports.QUERY_17 = QUERY_17;
+exports.QUERY_18 = QUERY_18;
+exports.QUERY_19 = QUERY_19;
+exports.QUERY_20 = QUERY_20;
+exports.QUERY_21 = QUERY_21;
+exports.QUERY_22 = QUERY_22;
+exports.QUERY_23 = QUERY_23;
+exports.QUERY_24 = QUERY_24;
+exports.QUERY_25 = QUERY_25;
+exports.QUERY_26 = QUERY_26;
+exports.QUERY_27 = QUERY_27;
+exports.QUERY_28 = QUERY_28;
+exports.QUERY_29 = QUERY_29;
+exports.QUERY_30 = QUERY_30;
+exports.QUERY_31 = QUERY_31;
+exports.QUERY_32 = QUERY_32;
+exports.QUERY_33 = QUERY_33;
+exports.QUERY_34 = QUERY_34;
+exports.QUERY_35 = QUERY_35;
+exports.QUERY_36 = QUERY_36;
+exports.QUERY_37 = QUERY_37;
+exports.QUERY_38 = QUERY_38;
+exports.QUERY_39 = QUERY_39;
+exports.QUERY_40 = QUERY_40;
+exports.QUERY_41 = QUERY_41;
+exports.QUERY_42 = QUERY_42;
+exports.QUERY_43 = QUERY_43;
+exports.QUERY_44 = QUERY_44;
+exports.QUERY_45 = QUERY_45;
+exports.QUERY_46 = QUERY_46;
+exports.QUERY_47 = QUERY_47;
+exports.QUERY_48 = QUERY_48;
+exports.QUERY_49 = QUERY_49;
+exports.QUERY_50 = QUERY_50;
+exports.QUERY_51 = QUERY_51;
+exports.QUERY_52 = QUERY_52;
+exports.QUERY_53 = QUERY_53;
+exports.QUERY_54 = QUERY_54;
+exports.QUERY_55 = QUERY_55;
+exports.QUERY_56 = QUERY_56;
+exports.QUERY_57 = QUERY_57;
+exports.QUERY_58 = QUERY_58;
+exports.QUERY_59 = QUERY_59;
@@ -0,0 +1,113 @@
+"use strict";
+var __createBinding = (this && this.__createBinding) || (Object.create ? (function(o, m, k, k2) {
+    if (k2 === undefined) k2 = k;
+    var desc = Object.getOwnPropertyDescriptor(m, k);
+    if (!desc || ("get" in desc ? !m.__esModule : desc.writable || desc.configurable)) {
+      desc = { enumerable: true, get: function() { return m[k]; } };
+    }
+    Object.defineProperty(o, k2, desc);
+}) : (function(o, m, k, k2) {
+    if (k2 === undefined) k2 = k;
+    o[k2] = m[k];
+}));
+var __exportStar = (this && this.__exportStar) || function(m, exports) {
+    for (var p in m) if (p !== "default" && !Object.prototype.hasOwnProperty.call(exports, p)) __createBinding(exports, m, p);
+};
+var __awaiter = (this && this.__awaiter) || function (thisArg, _arguments, P, generator) {
+    function adopt(value) { return value instanceof P ? value : new P(function (resolve) { resolve(value); }); }
+    return new (P || (P = Promise))(function (resolve, reject) {
+        function fulfilled(value) { try { step(generator.next(value)); } catch (e) { reject(e); } }
+        function rejected(value) { try { step(generator["throw"](value)); } catch (e) { reject(e); } }
+        function step(result) { result.done ? resolve(result.value) : adopt(result.value).then(fulfilled, rejected); }
+        step((generator = generator.apply(thisArg, _arguments || [])).next());
+    });
+};
+Object.defineProperty(exports, "__esModule", { value: true });
+exports.RequestQueue = exports.createClient = exports.DEFAULT_TIMEOUT = exports.HttpError = void 0;
+const events_1 = require("events");
+const retry_1 = require("./retry");
+const url_1 = require("./url");
+__exportStar(require("./types"), exports);
+__exportStar(require("./headers"), exports);
+__exportStar(require("./interceptors"), exports);
+var serializer_1 = require("./serializer");
+Object.defineProperty(exports, "serialize", { enumerable: true, get: function () { return serializer_1.serialize; } });
+Object.defineProperty(exports, "deserialize", { enumerable: true, get: function () { return serializer_1.deserialize; } });
+var cache_1 = require("./cache");
+Object.defineProperty(exports, "ResponseCache", { enumerable: true, get: function () { return cache_1.ResponseCache; } });
+/**
+ * Error thrown when the server responds with a non-2xx status code.
+ */
+class HttpError extends Error {
+    constructor(status, statusText, body) {
+        super(`Request failed with status ${status}: ${statusText}`);
+        this.status = status;
+        this.statusText = statusText;
+        this.body = body;
+        this.name = "HttpError";
+    }
+    get retryable() {
+        return this.status >= 500 || this.status === 429;
+    }
+}
+exports.HttpError = HttpError;
+exports.DEFAULT_TIMEOUT = 30000;
+/**
+ * Creates a configured HTTP client.
+ *
+ * @param options - Client options.
+ * @returns The client instance.
+ */
+function createClient(options = {}) {
+    var _a, _b;
+    const timeout = (_a = options.timeout) !== null && _a !== void 0 ? _a : exports.DEFAULT_TIMEOUT;
+    const retries = (_b = options.retries) !== null && _b !== void 0 ? _b : 3;
+    const base = new url_1.BaseUrl(options.baseUrl);
+    const emitter = new events_1.EventEmitter();
+    function request(method, path, body) {
+        return __awaiter(this, void 0, void 0, function* () {
+            const target = base.resolve(path);
+            emitter.emit("request", { method, target });
+            return (0, retry_1.withRetry)(() => __awaiter(this, void 0, void 0, function* () {
+                const response = yield fetch(target, { method, body: JSON.stringify(body), signal: AbortSignal.timeout(timeout) });
+                if (!response.ok) {
+                    throw new HttpError(response.status, response.statusText, yield response.text());
+                }
+                return response.json();
+            }), { retries, shouldRetry: (err) => err instanceof HttpError && err.retryable });
+        });
+    }
+    return {
+        get: (path) => request("GET", path),
+        post: (path, body) => request("POST", path, body),
+        put: (path, body) => request("PUT", path, body),
+        delete: (path) => request("DELETE", path),
+        on: emitter.on.bind(emitter),
+    };
+}
+exports.createClient = createClient;
+class RequestQueue {
+    constructor(concurrency = 4) {
+        this.concurrency = concurrency;
+        this.active = 0;
+        this.pending = [];
+    }
+    push(task) {
+        return new Promise((resolve, reject) => {
+            this.pending.push({ task, resolve, reject });
+            this.drain();
+        });
+    }
+    drain() {
+        while (this.active < this.concurrency && this.pending.length > 0) {
+            const { task, resolve, reject } = this.pending.shift();
+            this.active++;
+            task().then(resolve, reject).finally(() => {
+                this.active--;
+                this.drain();
+            });
+        }
+    }
+}
+exports.RequestQueue = RequestQueue;
+//# sourceMappingURL=index.js.map
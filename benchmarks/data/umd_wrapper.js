@@ -0,0 +1,111 @@
+(function (global, factory) {
+  typeof exports === 'object' && typeof module !== 'undefined' ? factory(exports, require('tslib'), require('./scheduler')) :
+  typeof define === 'function' && define.amd ? define(['exports', 'tslib', './scheduler'], factory) :
+  (global = typeof globalThis !== 'undefined' ? globalThis : global || self, factory(global.Observables = {}, global.tslib, global.scheduler));
+})(this, (function (exports, tslib, scheduler) { 'use strict';
+
+  var Subscription = /** @class */ (function () {
+      function Subscription(teardown) {
+          this.closed = false;
+          this._teardowns = teardown ? [teardown] : [];
+      }
+      Subscription.prototype.add = function (teardown) {
+          if (this.closed) {
+              teardown();
+          }
+          else {
+              this._teardowns.push(teardown);
+          }
+      };
+      Subscription.prototype.unsubscribe = function () {
+          if (this.closed) return;
+          this.closed = true;
+          for (var i = 0; i < this._teardowns.length; i++) {
+              this._teardowns[i]();
+          }
+          this._teardowns.length = 0;
+      };
+      return Subscription;
+  }());
+
+  var Observable = /** @class */ (function () {
+      function Observable(subscribe) {
+          this._subscribe = subscribe;
+      }
+      Observable.prototype.subscribe = function (observer) {
+          var subscription = new Subscription();
+          var safe = typeof observer === 'function' ? { next: observer } : observer;
+          var teardown = this._subscribe({
+              next: function (value) { if (!subscription.closed && safe.next) safe.next(value); },
+              error: function (err) { if (!subscription.closed) { subscription.unsubscribe(); safe.error && safe.error(err); } },
+              complete: function () { if (!subscription.closed) { subscription.unsubscribe(); safe.complete && safe.complete(); } }
+          });
+          if (teardown) subscription.add(teardown);
+          return subscription;
+      };
+      Observable.prototype.pipe = function () {
+          var operators = [];
+          for (var _i = 0; _i < arguments.length; _i++) {
+              operators[_i] = arguments[_i];
+          }
+          return operators.reduce(function (source, op) { return op(source); }, this);
+      };
+      return Observable;
+  }());
+
+  function map(project) {
+      return function (source) {
+          return new Observable(function (observer) {
+              var index = 0;
+              var sub = source.subscribe({
+                  next: function (value) { observer.next(project(value, index++)); },
+                  error: function (err) { observer.error(err); },
+                  complete: function () { observer.complete(); }
+              });
+              return function () { return sub.unsubscribe(); };
+          });
+      };
+  }
+
+  function filter(predicate) {
+      return function (source) {
+          return new Observable(function (observer) {
+              var sub = source.subscribe({
+                  next: function (value) { if (predicate(value)) observer.next(value); },
+                  error: function (err) { observer.error(err); },
+                  complete: function () { observer.complete(); }
+              });
+              return function () { return sub.unsubscribe(); };
+          });
+      };
+  }
+
+  function interval(period) {
+      return new Observable(function (observer) {
+          var n = 0;
+          var handle = scheduler.schedule(function tick() {
+              observer.next(n++);
+              handle = scheduler.schedule(tick, period);
+          }, period);
+          return function () { return scheduler.cancel(handle); };
+      });
+  }
+
+  function of() {
+      var values = tslib.__spreadArray([], arguments, true);
+      return new Observable(function (observer) {
+          for (var i = 0; i < values.length; i++) observer.next(values[i]);
+          observer.complete();
+      });
+  }
+
+  exports.Observable = Observable;
+  exports.Subscription = Subscription;
+  exports.filter = filter;
+  exports.interval = interval;
+  exports.map = map;
+  exports.of = of;
+
+  Object.defineProperty(exports, '__esModule', { value: true });
+
+}));
@@ -1,6 +1,7 @@
 option(MERVE_LOGGING "verbose output (useful for debugging)" OFF)
 option(MERVE_SANITIZE "Sanitize addresses" OFF)
 option(MERVE_USE_SIMDUTF "Use simdutf for optimized string operations" OFF)
+option(MERVE_STRUCTURAL_INDEX "Lex in two stages, jumping between bytes found by a vectorized pass" OFF)
 if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
   option(MERVE_SANITIZE_BOUNDS_STRICT "Sanitize bounds (strict): only for GCC" OFF)
 endif()
@@ -1,6 +1,11 @@
 #ifndef MERVE_H
 #define MERVE_H
 
+#include "merve/batch.h"
+#include "merve/cache.h"
+#include "merve/disk_cache.h"
+#include "merve/file.h"
+#include "merve/implementation.h"
 #include "merve/parser.h"
 
 #endif  // MERVE_H
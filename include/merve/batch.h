@@ -0,0 +1,72 @@
+#ifndef MERVE_BATCH_H
+#define MERVE_BATCH_H
+
+#include "merve/parser.h"
+
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace lexer {
+
+/**
+ * @brief Options for parse_commonjs_batch().
+ */
+struct batch_options {
+  /**
+   * @brief Number of threads to parse on, including the calling thread.
+   *
+   * 0 uses std::thread::hardware_concurrency(). Never more threads than
+   * inputs are started.
+   */
+  unsigned threads = 0;
+};
+
+/**
+ * @brief Outcome of parsing one input of a batch.
+ */
+struct batch_result {
+  std::optional<lexer_analysis> analysis{};  ///< std::nullopt if parsing failed
+  std::optional<lexer_error> error{};        ///< Why parsing failed, if it did
+  std::optional<error_location> location{};  ///< Where parsing failed, if it did
+};
+
+/**
+ * @brief Parse many CommonJS sources in parallel.
+ *
+ * Each worker thread starts with an equal share of the inputs. A worker that
+ * runs out takes half of the remaining inputs of another one, so a few
+ * large files do not leave the other threads idle. The calling thread is
+ * one of the workers and the function returns once every input is parsed.
+ *
+ * There is no persistent pool: each call starts its own threads and joins
+ * them before returning. Starting a thread costs tens of microseconds, so
+ * for many small batches, merge them into larger ones or set
+ * batch_options::threads to 1 and parse them on threads of your own with a
+ * lexer::parser each.
+ *
+ * @param inputs The JavaScript sources to analyze
+ * @param options See batch_options
+ * @return One batch_result per input, in the order of `inputs`.
+ *
+ * @note The sources must remain valid while using string_view exports.
+ * @note get_last_error() is not updated; use batch_result::error.
+ *
+ * Example:
+ * @code
+ * std::vector<std::string_view> sources = ...;
+ * auto results = lexer::parse_commonjs_batch(sources, {.threads = 8});
+ * for (size_t i = 0; i < results.size(); i++) {
+ *   if (results[i].analysis) {
+ *     // results[i].analysis->exports belong to sources[i]
+ *   }
+ * }
+ * @endcode
+ */
+std::vector<batch_result> parse_commonjs_batch(std::span<const std::string_view> inputs,
+                                               const batch_options& options = {});
+
+}  // namespace lexer
+
+#endif  // MERVE_BATCH_H
@@ -0,0 +1,112 @@
+#ifndef MERVE_CACHE_H
+#define MERVE_CACHE_H
+
+#include "merve/parser.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace lexer {
+
+/**
+ * @brief A 128-bit hash of a source, see hash_source().
+ */
+struct source_hash {
+  uint64_t low;
+  uint64_t high;
+
+  bool operator==(const source_hash&) const = default;
+};
+
+/**
+ * @brief Hash a source for use as a cache key.
+ *
+ * A fast non-cryptographic hash that reads 16 bytes per step. With 128 bits,
+ * accidental collisions are negligible, but sources crafted to collide are
+ * not ruled out: do not share a cache between mutually distrusting parties.
+ * Hashes depend on the byte order of the machine.
+ */
+source_hash hash_source(std::string_view source) noexcept;
+
+/**
+ * @brief Hit and miss counts of an analysis_cache.
+ */
+struct cache_statistics {
+  uint64_t hits = 0;    ///< Lookups answered from the cache
+  uint64_t misses = 0;  ///< Lookups that had to lex the source
+  size_t size = 0;      ///< Sources currently cached
+};
+
+/**
+ * @brief A bounded, thread-safe cache of analyses keyed by source content.
+ *
+ * Maps hash_source() of each source to the outcome of parsing it, so a
+ * source seen before is not lexed again, whatever buffer it is in. Results
+ * are kept as self-contained compact_analysis copies, and the least recently
+ * used one is dropped once the cache is full. Failures are cached too. The
+ * source length is kept with each result, so a colliding source of another
+ * length is lexed rather than answered from the cache.
+ *
+ * The cache is split into shards, each with its own lock and its own share
+ * of the capacity, so threads looking up different sources rarely wait for
+ * each other. Sources are lexed without holding a lock.
+ *
+ * Example:
+ * @code
+ * static lexer::analysis_cache cache(4096);
+ * auto result = cache.parse(source);
+ * if (result) {
+ *   for (const auto& entry : result->exports()) {
+ *     std::cout << result->name(entry) << std::endl;
+ *   }
+ * }
+ * @endcode
+ */
+class analysis_cache {
+ public:
+  /**
+   * @param capacity Maximum number of sources to keep, at least 1
+   * @param shards Number of independently locked shards. 0 picks a number
+   *        from std::thread::hardware_concurrency(). Never more shards than
+   *        `capacity` are used.
+   */
+  explicit analysis_cache(size_t capacity, size_t shards = 0);
+  ~analysis_cache();
+
+  analysis_cache(const analysis_cache&) = delete;
+  analysis_cache& operator=(const analysis_cache&) = delete;
+
+  /**
+   * @brief Parse a source, or return the cached result for the same content.
+   *
+   * @return The analysis, or nullptr if parsing failed (see get_last_error()
+   *         and get_last_error_location(), which are also set on hits). The
+   *         result does not refer to `source` and remains valid after it is
+   *         evicted from the cache.
+   */
+  std::shared_ptr<const compact_analysis> parse(std::string_view source);
+
+  /**
+   * @brief Hits and misses since construction or the last clear().
+   */
+  cache_statistics statistics() const;
+
+  /**
+   * @brief Drop every cached result and reset the statistics.
+   */
+  void clear();
+
+ private:
+  struct shard;
+
+  shard& shard_for(const source_hash& hash) const noexcept;
+
+  std::unique_ptr<shard[]> shards_;
+  size_t shard_count_;  // A power of two
+};
+
+}  // namespace lexer
+
+#endif  // MERVE_CACHE_H
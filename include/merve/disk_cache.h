@@ -0,0 +1,171 @@
+#ifndef MERVE_DISK_CACHE_H
+#define MERVE_DISK_CACHE_H
+
+#include "merve/cache.h"
+#include "merve/parser.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace lexer {
+
+/**
+ * @brief An analysis stored in a disk_cache, read in place.
+ *
+ * Has the same layout and accessors as a compact_analysis, but refers to the
+ * cache file's mapping: it is valid for as long as the disk_cache it came
+ * from exists.
+ */
+class cached_analysis {
+ public:
+  /**
+   * @brief Named exports found in the module, see lexer_analysis::exports.
+   */
+  std::span<const compact_export> exports() const noexcept { return entries_.first(export_count_); }
+
+  /**
+   * @brief Re-exported module specifiers, see lexer_analysis::re_exports.
+   */
+  std::span<const compact_export> re_exports() const noexcept { return entries_.subspan(export_count_); }
+
+  /**
+   * @brief Get the name of an entry of exports() or re_exports().
+   */
+  std::string_view name(const compact_export& entry) const noexcept {
+    return std::string_view(names_ + entry.offset, entry.length);
+  }
+
+  /**
+   * @brief Why parsing the source failed, if it did. exports() and
+   *        re_exports() are empty then.
+   */
+  std::optional<lexer_error> error() const noexcept { return error_; }
+
+  /**
+   * @brief Where parsing failed. Requires error().
+   */
+  error_location location() const noexcept { return location_; }
+
+ private:
+  friend class disk_cache;
+
+  cached_analysis(std::span<const compact_export> entries, size_t export_count, const char* names,
+                  std::optional<lexer_error> error, error_location location) noexcept
+      : entries_(entries), export_count_(export_count), names_(names), error_(error), location_(location) {}
+
+  std::span<const compact_export> entries_;  // Exports, then re-exports
+  size_t export_count_;
+  const char* names_;
+  std::optional<lexer_error> error_;
+  error_location location_;
+};
+
+/**
+ * @brief A persistent cache of analyses, stored in one file.
+ *
+ * The file holds a hash index and the compact export tables of every cached
+ * source, and is mapped read-only when the cache is opened: a lookup costs a
+ * few page faults and hands out views of the mapping, without reading or
+ * copying the file. Windows cannot replace a mapped file, so there the file
+ * is read into memory instead. Files written by another version of merve,
+ * for another byte order, or damaged are ignored.
+ *
+ * New results are kept in memory until save(), which writes the entries on
+ * disk at that time together with the new ones to a temporary file, flushes
+ * it to the disk and renames it over the cache file. Readers therefore never
+ * see a partial file, and keep their own mapping or copy intact. Saves from
+ * several processes do not corrupt the file, but one of them may drop what
+ * the others added.
+ *
+ * Example:
+ * @code
+ * lexer::disk_cache cache(".cache/merve");
+ * for (const auto& path : paths) {
+ *   std::string source = read(path);
+ *   if (auto result = cache.parse(source)) {
+ *     use(result->exports());
+ *   }
+ * }
+ * std::error_code ec;
+ * cache.save(ec);
+ * @endcode
+ */
+class disk_cache {
+ public:
+  /**
+   * @brief Open the cache stored at `path`. A missing or unusable file gives
+   *        an empty cache, which save() creates.
+   */
+  explicit disk_cache(std::filesystem::path path);
+  ~disk_cache();
+
+  /**
+   * A moved-from cache is empty and has no file: parse() caches in memory
+   * only, and save() fails with std::errc::invalid_argument.
+   */
+  disk_cache(disk_cache&& other) noexcept;
+  disk_cache& operator=(disk_cache&& other) noexcept;
+  disk_cache(const disk_cache&) = delete;
+  disk_cache& operator=(const disk_cache&) = delete;
+
+  /**
+   * @brief Look up a key, without parsing anything.
+   *
+   * @return The cached analysis or failure, or std::nullopt if `key` is not
+   *         cached. Unlike parse(), does not check the source length.
+   */
+  std::optional<cached_analysis> find(const source_hash& key) const noexcept;
+
+  /**
+   * @brief Parse a source, or return the cached result for the same content.
+   *
+   * A cached result for a source of another length, which can only come
+   * from a hash collision, is replaced.
+   *
+   * @return The analysis, or std::nullopt if parsing failed (see
+   *         get_last_error(), which is also set on hits).
+   */
+  std::optional<cached_analysis> parse(std::string_view source);
+
+  /**
+   * @brief Parse a source cached under a key of the caller's choice.
+   *
+   * For example the hash of a file's path, size and modification time lets
+   * find() answer before the file is read.
+   */
+  std::optional<cached_analysis> parse(const source_hash& key, std::string_view source);
+
+  /**
+   * @brief Number of results cached on disk or added since opening.
+   */
+  size_t size() const noexcept;
+
+  /**
+   * @brief Write the cache file, see above.
+   *
+   * @return Whether the file was written; `ec` says why not otherwise.
+   */
+  bool save(std::error_code& ec) const;
+
+ private:
+  struct state;
+
+  // The analysis a record of the file format refers to.
+  static cached_analysis view(const char* record) noexcept;
+
+  // The record cached under `key`, or null.
+  const char* find_record(const source_hash& key) const noexcept;
+
+  std::unique_ptr<state> state_;
+};
+
+}  // namespace lexer
+
+#endif  // MERVE_DISK_CACHE_H
@@ -0,0 +1,88 @@
+#ifndef MERVE_FILE_H
+#define MERVE_FILE_H
+
+#include "merve/parser.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <system_error>
+
+namespace lexer {
+
+/**
+ * @brief The analysis of a file, together with the file contents it refers to.
+ *
+ * Returned by parse_commonjs_file(). The contents stay mapped for as long as
+ * the file_analysis exists, so string_view exports remain valid, also after
+ * the file_analysis is moved.
+ */
+class file_analysis {
+ public:
+  file_analysis(file_analysis&& other) noexcept;
+  file_analysis& operator=(file_analysis&& other) noexcept;
+  file_analysis(const file_analysis&) = delete;
+  file_analysis& operator=(const file_analysis&) = delete;
+  ~file_analysis();
+
+  const lexer_analysis& analysis() const noexcept { return analysis_; }
+  const lexer_analysis& operator*() const noexcept { return analysis_; }
+  const lexer_analysis* operator->() const noexcept { return &analysis_; }
+
+  /**
+   * @brief The contents of the file that was parsed.
+   */
+  std::string_view source() const noexcept { return std::string_view(data_, size_); }
+
+ private:
+  friend std::optional<file_analysis> parse_commonjs_file(const std::filesystem::path& path, std::error_code& ec);
+
+  file_analysis(const char* data, size_t size, bool mapped) noexcept : data_(data), size_(size), mapped_(mapped) {}
+  void release() noexcept;
+
+  const char* data_;
+  size_t size_;
+  // Whether data_ is a read-only mapping of the file or a heap copy of it.
+  bool mapped_;
+  lexer_analysis analysis_{};
+};
+
+/**
+ * @brief Parse a CommonJS file without copying it into memory first.
+ *
+ * Regular files are mapped read-only with a sequential-access hint and
+ * parsed in place; other files, such as pipes, are read into a buffer.
+ *
+ * @param path The file to analyze
+ * @param ec Set if the file cannot be read, cleared otherwise
+ * @return The analysis, or std::nullopt if the file cannot be read or
+ *         parsing fails (see get_last_error()).
+ *
+ * @note The file must not be truncated while the result exists: reading a
+ *       mapped page past the end of a file is a fatal error on most systems.
+ *
+ * Example:
+ * @code
+ * std::error_code ec;
+ * auto result = lexer::parse_commonjs_file("dist/index.js", ec);
+ * if (result) {
+ *   for (const auto& exp : result->analysis().exports) {
+ *     std::cout << lexer::get_string_view(exp) << std::endl;
+ *   }
+ * }
+ * @endcode
+ */
+std::optional<file_analysis> parse_commonjs_file(const std::filesystem::path& path, std::error_code& ec);
+
+/**
+ * @brief Parse a CommonJS file, see above.
+ *
+ * @return The analysis, or std::nullopt if the file cannot be read or
+ *         parsing fails.
+ */
+std::optional<file_analysis> parse_commonjs_file(const std::filesystem::path& path);
+
+}  // namespace lexer
+
+#endif  // MERVE_FILE_H
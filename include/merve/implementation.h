@@ -0,0 +1,87 @@
+#ifndef MERVE_IMPLEMENTATION_H
+#define MERVE_IMPLEMENTATION_H
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace lexer {
+
+/**
+ * @brief One build of the lexer's SIMD scanning kernels.
+ *
+ * The library contains kernels for several instruction sets and picks the
+ * best one the CPU supports on first use, so a single binary runs on every
+ * machine of its architecture. Setting the `MERVE_FORCE_IMPLEMENTATION`
+ * environment variable to an implementation name overrides that choice, as
+ * does set_active_implementation().
+ *
+ * | Name       | Instruction sets                   |
+ * |------------|------------------------------------|
+ * | `avx512bw` | AVX-512F, AVX-512BW, BMI1/2 (x64)  |
+ * | `avx2`     | AVX2, BMI1/2 (x64)                 |
+ * | `sse42`    | SSE4.2, POPCNT (x64)               |
+ * | `neon`     | NEON (ARM64)                       |
+ * | `scalar`   | none                               |
+ */
+class implementation {
+ public:
+  /**
+   * @brief Short name, e.g. "avx2". Accepted by set_active_implementation()
+   *        and `MERVE_FORCE_IMPLEMENTATION`.
+   */
+  std::string_view name() const noexcept { return name_; }
+
+  /**
+   * @brief Human-readable description of the targeted instruction sets.
+   */
+  std::string_view description() const noexcept { return description_; }
+
+  /**
+   * @brief Whether the current CPU can run this implementation.
+   */
+  bool supported_by_runtime_system() const noexcept;
+
+ protected:
+  constexpr implementation(std::string_view name, std::string_view description,
+                           uint32_t required_instruction_sets) noexcept
+      : name_(name), description_(description), required_instruction_sets_(required_instruction_sets) {}
+  ~implementation() = default;
+
+ private:
+  std::string_view name_;
+  std::string_view description_;
+  uint32_t required_instruction_sets_;
+};
+
+/**
+ * @brief Get the implementation used by parse_commonjs().
+ *
+ * Selected on first use: `MERVE_FORCE_IMPLEMENTATION` if it names a
+ * supported implementation, otherwise the best one the CPU supports.
+ */
+const implementation& get_active_implementation();
+
+/**
+ * @brief Get every implementation compiled into the library, best first.
+ *
+ * Includes implementations the current CPU cannot run; check
+ * implementation::supported_by_runtime_system() before using one.
+ */
+std::span<const implementation* const> get_available_implementations();
+
+/**
+ * @brief Make the named implementation active, e.g. to benchmark it.
+ *
+ * Parses already in progress finish with the implementation they started
+ * with.
+ *
+ * @param name An implementation::name()
+ * @return true on success, false if the name is unknown or the CPU does
+ *         not support it (the active implementation is then unchanged).
+ */
+bool set_active_implementation(std::string_view name);
+
+}  // namespace lexer
+
+#endif  // MERVE_IMPLEMENTATION_H
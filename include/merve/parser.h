@@ -4,7 +4,10 @@
 #include "merve/version.h"
 
 #include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -35,6 +38,20 @@ enum lexer_error {
 
   // Resource limit errors
   TEMPLATE_NEST_OVERFLOW, ///< Template literal nesting too deep
+
+  // Encoding errors
+  INVALID_UTF8, ///< Source is not valid UTF-8 (parse_commonjs_validated() only)
+
+  // Resource limit errors, continued
+  SOURCE_TOO_LARGE, ///< Source is 4 GiB (or 4Gi UTF-16 code units) or larger
+};
+
+/**
+ * @brief Where a parse failed.
+ */
+struct error_location {
+  uint32_t offset;  ///< Byte offset in the source where the error was detected
+  uint32_t line;    ///< 1-based line number of `offset`
 };
 
 /**
@@ -105,6 +122,54 @@ inline std::string_view get_string_view(const export_entry& e) {
   return get_string_view(e.name);
 }
 
+namespace pmr {
+
+/**
+ * @brief lexer::export_string whose unescaped names are allocated from a
+ *        std::pmr::memory_resource.
+ */
+using export_string = std::variant<std::pmr::string, std::string_view>;
+
+/**
+ * @brief lexer::export_entry whose unescaped names are allocated from a
+ *        std::pmr::memory_resource.
+ */
+struct export_entry {
+  export_string name;
+  uint32_t line;  // 1-based line number
+};
+
+/**
+ * @brief lexer::lexer_analysis allocated from a std::pmr::memory_resource,
+ *        see parse_commonjs(std::string_view, std::pmr::memory_resource*).
+ */
+struct lexer_analysis {
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  lexer_analysis() = default;
+  explicit lexer_analysis(const allocator_type& allocator) : exports(allocator), re_exports(allocator) {}
+
+  std::pmr::vector<export_entry> exports{};     ///< See lexer::lexer_analysis::exports
+  std::pmr::vector<export_entry> re_exports{};  ///< See lexer::lexer_analysis::re_exports
+};
+
+}  // namespace pmr
+
+/**
+ * @brief Get a string_view from a pmr::export_string variant.
+ */
+inline std::string_view get_string_view(const pmr::export_string& s) {
+  return std::visit([](const auto& v) -> std::string_view { return v; }, s);
+}
+
+/**
+ * @brief Get a string_view from a pmr::export_entry (delegates to the name
+ *        field).
+ */
+inline std::string_view get_string_view(const pmr::export_entry& e) {
+  return get_string_view(e.name);
+}
+
 /**
  * @brief Parse CommonJS source code and extract export information.
  *
@@ -135,6 +200,352 @@ inline std::string_view get_string_view(const export_entry& e) {
  */
 std::optional<lexer_analysis> parse_commonjs(std::string_view file_contents);
 
+/**
+ * @brief The analysis of a module, or the error that stopped parsing it.
+ *
+ * Returned by parse_commonjs_result(). Unlike get_last_error(), the error
+ * travels with the result, so it can be checked on any thread, at any time.
+ */
+class parse_result {
+ public:
+  explicit parse_result(lexer_analysis analysis) : result_(std::move(analysis)) {}
+  explicit parse_result(lexer_error error, error_location location = {}) : result_(failure{error, location}) {}
+
+  /**
+   * @brief Whether parsing succeeded.
+   */
+  bool has_value() const noexcept { return std::holds_alternative<lexer_analysis>(result_); }
+  explicit operator bool() const noexcept { return has_value(); }
+
+  /**
+   * @brief The analysis. Requires has_value().
+   */
+  lexer_analysis& value() & { return std::get<lexer_analysis>(result_); }
+  const lexer_analysis& value() const& { return std::get<lexer_analysis>(result_); }
+  lexer_analysis&& value() && { return std::get<lexer_analysis>(std::move(result_)); }
+
+  lexer_analysis& operator*() & { return value(); }
+  const lexer_analysis& operator*() const& { return value(); }
+  lexer_analysis* operator->() { return &value(); }
+  const lexer_analysis* operator->() const { return &value(); }
+
+  /**
+   * @brief Why parsing failed. Requires !has_value().
+   */
+  lexer_error error() const { return std::get<failure>(result_).error; }
+
+  /**
+   * @brief Where parsing failed. Requires !has_value().
+   */
+  error_location location() const { return std::get<failure>(result_).location; }
+
+ private:
+  struct failure {
+    lexer_error error;
+    error_location location;
+  };
+  std::variant<lexer_analysis, failure> result_;
+};
+
+/**
+ * @brief Parse CommonJS source code, returning the error with the result.
+ *
+ * Detects the same patterns as parse_commonjs(), but reports failures in
+ * the returned parse_result instead of the thread-local get_last_error(),
+ * which it does not update.
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @return The analysis result, or the error that stopped parsing.
+ *
+ * @note The source must remain valid while using string_view exports.
+ *
+ * Example:
+ * @code
+ * lexer::parse_result result = lexer::parse_commonjs_result(source);
+ * if (result) {
+ *   use(result->exports);
+ * } else {
+ *   report(result.error());
+ * }
+ * @endcode
+ */
+parse_result parse_commonjs_result(std::string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code that must be valid UTF-8.
+ *
+ * Same as parse_commonjs(), but fails with INVALID_UTF8 unless the whole
+ * source is valid UTF-8. The source is validated a chunk at a time just
+ * ahead of the lexer, so it is read from memory once instead of twice as
+ * with a separate validation pass. Invalid UTF-8 is reported instead of any
+ * other error, at the start of the first invalid sequence.
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @return The analysis result, or std::nullopt on error (see get_last_error()).
+ *
+ * @note The source must remain valid while using string_view exports.
+ */
+std::optional<lexer_analysis> parse_commonjs_validated(std::string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code that must be valid UTF-8, returning the
+ * error with the result. See parse_commonjs_validated().
+ */
+parse_result parse_commonjs_validated_result(std::string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code held as Latin-1, such as V8's one-byte
+ * strings.
+ *
+ * The source is lexed in place, without converting it to UTF-8 first. ASCII
+ * export names are string_views into the source like with parse_commonjs();
+ * only names containing bytes >= 0x80 are converted to UTF-8 std::string
+ * values.
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @return The analysis result, or std::nullopt on error (see get_last_error()).
+ *
+ * @note The source must remain valid while using string_view exports.
+ */
+std::optional<lexer_analysis> parse_commonjs_latin1(std::string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code held as Latin-1, returning the error with
+ * the result. See parse_commonjs_latin1().
+ */
+parse_result parse_commonjs_latin1_result(std::string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code held as UTF-16, as JavaScript engines do.
+ *
+ * The source is lexed in place, without converting it to UTF-8 first. Export
+ * names are converted to UTF-8 std::string values, so the results never refer
+ * to the source; names containing a lone surrogate are skipped. Error
+ * offsets count UTF-16 code units. Code units below 0x100 are classified as
+ * in parse_commonjs_latin1(), e.g. U+00A0 is whitespace.
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @return The analysis result, or std::nullopt on error (see get_last_error()).
+ */
+std::optional<lexer_analysis> parse_commonjs(std::u16string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code held as UTF-16, returning the error with
+ * the result. See parse_commonjs(std::u16string_view).
+ */
+parse_result parse_commonjs_result(std::u16string_view file_contents);
+
+/**
+ * @brief Parse CommonJS source code into a result that keeps its source alive.
+ *
+ * Detects the same patterns as parse_commonjs(). The returned analysis
+ * holds a reference to `source`, so its string_view exports stay valid for
+ * as long as any copy of the pointer exists: the result can be handed to
+ * other threads or kept in a cache without keeping the source alive
+ * separately or copying names.
+ *
+ * @param source The JavaScript source code to analyze. Other owners, e.g. a
+ *        std::string, can be shared through the aliasing constructor of
+ *        std::shared_ptr.
+ * @param length The length of the source in bytes
+ * @return The analysis result, or nullptr if parsing failed. Use
+ *         get_last_error() to get error details.
+ *
+ * Example:
+ * @code
+ * auto text = std::make_shared<const std::string>(read_file(path));
+ * std::shared_ptr<const lexer::lexer_analysis> result =
+ *     lexer::parse_commonjs_shared({text, text->data()}, text->size());
+ * @endcode
+ */
+std::shared_ptr<const lexer_analysis> parse_commonjs_shared(std::shared_ptr<const char[]> source, size_t length);
+
+/**
+ * @brief Parse CommonJS source code, allocating the result from `resource`.
+ *
+ * Detects the same patterns as parse_commonjs(). The lexer writes the
+ * result's vectors and unescaped names straight into `resource`, e.g. a
+ * std::pmr::monotonic_buffer_resource that is released once a whole batch
+ * of modules is done with, so modules with fewer than 32 exports are lexed
+ * without touching the heap.
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @param resource The memory resource to allocate the result from
+ * @return The analysis result, or std::nullopt if parsing failed. Use
+ *         get_last_error() to get error details.
+ *
+ * @note The source must remain valid while using string_view exports.
+ *
+ * Example:
+ * @code
+ * std::pmr::monotonic_buffer_resource arena;
+ * std::vector<lexer::pmr::lexer_analysis> results;
+ * for (const std::string& source : sources) {
+ *   if (auto result = lexer::parse_commonjs(source, &arena)) {
+ *     results.push_back(std::move(*result));
+ *   }
+ * }
+ * @endcode
+ */
+std::optional<pmr::lexer_analysis> parse_commonjs(std::string_view file_contents, std::pmr::memory_resource* resource);
+
+/**
+ * @brief An export name in a compact_analysis, 16 bytes per entry.
+ *
+ * The name is `length` bytes at `offset` in the source, or in the result's
+ * arena when the name had to be unescaped. Use compact_analysis::name() to
+ * read it.
+ */
+struct compact_export {
+  /// Set in `flags` when the name lives in the arena rather than the source.
+  static constexpr uint32_t in_arena = 1;
+
+  uint32_t offset;  ///< Byte offset of the name in the source or the arena
+  uint32_t length;  ///< Length of the name in bytes
+  uint32_t line;    ///< 1-based line number
+  uint32_t flags;   ///< Zero or compact_export::in_arena
+};
+
+/**
+ * @brief Result of parsing a CommonJS module, in two allocations.
+ *
+ * Holds the same exports and re-exports as a lexer_analysis, but stores
+ * them in one vector of fixed-size compact_export entries and every
+ * unescaped name in one shared arena, instead of a variant per entry and a
+ * heap allocation per unescaped name. Prefer it when keeping the results
+ * for many modules in memory.
+ *
+ * @note Like the string_view exports of a lexer_analysis, names that did not
+ *       need unescaping point into the source, which must remain valid.
+ */
+class compact_analysis {
+ public:
+  compact_analysis() = default;
+
+  /**
+   * @brief Compact the result of parsing `source`.
+   *
+   * @param analysis The result of parse_commonjs(source) or
+   *        parser::parse(source)
+   * @param source The source code that was parsed
+   */
+  compact_analysis(const lexer_analysis& analysis, std::string_view source);
+
+  /**
+   * @brief Compact a result into a copy that does not refer to its source.
+   *
+   * Every name is copied into the arena, so the source may be freed.
+   */
+  explicit compact_analysis(const lexer_analysis& analysis) : compact_analysis(analysis, std::string_view()) {}
+
+  /**
+   * @brief Named exports found in the module, see lexer_analysis::exports.
+   */
+  std::span<const compact_export> exports() const noexcept {
+    return std::span<const compact_export>(entries_).first(export_count_);
+  }
+
+  /**
+   * @brief Re-exported module specifiers, see lexer_analysis::re_exports.
+   */
+  std::span<const compact_export> re_exports() const noexcept {
+    return std::span<const compact_export>(entries_).subspan(export_count_);
+  }
+
+  /**
+   * @brief Get the name of an entry of exports() or re_exports().
+   */
+  std::string_view name(const compact_export& entry) const noexcept {
+    const char* base = (entry.flags & compact_export::in_arena) ? arena_.data() : source_.data();
+    return std::string_view(base + entry.offset, entry.length);
+  }
+
+ private:
+  std::string_view source_{};
+  std::vector<compact_export> entries_{};  // Exports, then re-exports
+  std::string arena_{};
+  size_t export_count_ = 0;
+};
+
+/**
+ * @brief Parse CommonJS source code into a compact_analysis.
+ *
+ * Detects the same patterns as parse_commonjs().
+ *
+ * @param file_contents The JavaScript source code to analyze
+ * @return The analysis result, or std::nullopt if parsing failed. Use
+ *         get_last_error() to get error details.
+ *
+ * @note The source must remain valid while using the result.
+ */
+std::optional<compact_analysis> parse_commonjs_compact(std::string_view file_contents);
+
+/**
+ * @brief A CommonJS parser that can be reused across many modules.
+ *
+ * parse_commonjs() sets up a new lexer for every call, including about 30 KB
+ * of nesting stacks, and returns freshly allocated vectors. A parser keeps
+ * both between calls, which adds up when loading thousands of small modules.
+ *
+ * A parser is not thread-safe; use one per thread.
+ *
+ * There is no chunked interface: the lexer looks ahead arbitrarily far,
+ * e.g. across a whole object literal, and exports point into the source,
+ * so a module that arrives in chunks must be concatenated by the caller
+ * before parsing. Reusing one reserved std::string for that keeps it
+ * allocation-free once it has held the largest module.
+ *
+ * Example:
+ * @code
+ * lexer::parser parser;
+ * for (const std::string& source : sources) {
+ *   if (const lexer::lexer_analysis* result = parser.parse(source)) {
+ *     // Use result->exports before the next parse() call.
+ *   }
+ * }
+ * @endcode
+ */
+class parser {
+ public:
+  parser() noexcept;
+  ~parser();
+  parser(parser&&) noexcept;
+  parser& operator=(parser&&) noexcept;
+  parser(const parser&) = delete;
+  parser& operator=(const parser&) = delete;
+
+  /**
+   * @brief Parse CommonJS source code, reusing this parser's memory.
+   *
+   * Detects the same patterns as parse_commonjs().
+   *
+   * @param file_contents The JavaScript source code to analyze
+   * @return The analysis result, or nullptr if parsing failed. Use
+   *         get_last_error() to get error details. The result is owned by
+   *         the parser and valid until the next call to parse() or until the
+   *         parser is destroyed.
+   *
+   * @note The source must remain valid while using string_view exports.
+   */
+  const lexer_analysis* parse(std::string_view file_contents);
+
+  /**
+   * @brief Parse CommonJS source code into a compact_analysis, reusing this
+   *        parser's memory for everything but the result.
+   *
+   * @param file_contents The JavaScript source code to analyze
+   * @return The analysis result, or std::nullopt if parsing failed. Use
+   *         get_last_error() to get error details.
+   *
+   * @note The source must remain valid while using the result.
+   */
+  std::optional<compact_analysis> parse_compact(std::string_view file_contents);
+
+ private:
+  struct state;
+  std::unique_ptr<state> state_{};
+};
+
 /**
  * @brief Get the error from the last failed parse operation.
  *
@@ -142,10 +553,21 @@ std::optional<lexer_analysis> parse_commonjs(std::string_view file_contents);
  *         if the last parse succeeded.
  *
  * @note This is a global state and may be overwritten by subsequent calls
- *       to parse_commonjs().
+ *       to parse_commonjs() or parser::parse().
  */
 const std::optional<lexer_error>& get_last_error();
 
+/**
+ * @brief Get where the last failed parse operation stopped.
+ *
+ * Set together with get_last_error(): the byte offset and line at which the
+ * lexer detected the error. For a bracket or template left open at the end
+ * of the input, that is the end of the input.
+ *
+ * @return The location, or std::nullopt if the last parse succeeded.
+ */
+const std::optional<error_location>& get_last_error_location();
+
 }  // namespace lexer
 
 #endif  // MERVE_PARSER_H
@@ -30,6 +30,43 @@ typedef struct {
  */
 typedef void* merve_analysis;
 
+/**
+ * @brief Opaque handle to a reusable parser.
+ *
+ * Created by merve_parser_create(). Must be freed with merve_parser_free().
+ */
+typedef void* merve_parser;
+
+/**
+ * @brief An export or re-export written by merve_parse_commonjs_into().
+ */
+typedef struct {
+  merve_string name; /**< Points into the source or the caller's string buffer. */
+  uint32_t line;     /**< 1-based line number. */
+} merve_export;
+
+/**
+ * @brief Outcome of merve_parse_commonjs_into().
+ *
+ * The counts and string_length are the sizes the caller's buffers need,
+ * also when they were too small.
+ */
+typedef struct {
+  int error;              /**< MERVE_ERROR_* constant, or -1 on success. */
+  size_t error_offset;    /**< Byte offset of the error, 0 on success. */
+  uint32_t error_line;    /**< 1-based line of the error, 0 on success. */
+  size_t exports_count;   /**< Named exports found. */
+  size_t reexports_count; /**< Re-export specifiers found. */
+  size_t string_length;   /**< Bytes of unescaped names to copy. */
+} merve_result_info;
+
+/**
+ * @brief Releases a source buffer passed to merve_parse_commonjs_shared().
+ *
+ * @param context The `context` given with the buffer.
+ */
+typedef void (*merve_release_callback)(void* context);
+
 /**
  * @brief Version number components.
  */
@@ -53,6 +90,8 @@ typedef struct {
 #define MERVE_ERROR_UNEXPECTED_ESM_IMPORT 10
 #define MERVE_ERROR_UNEXPECTED_ESM_EXPORT 11
 #define MERVE_ERROR_TEMPLATE_NEST_OVERFLOW 12
+#define MERVE_ERROR_INVALID_UTF8 13
+#define MERVE_ERROR_SOURCE_TOO_LARGE 14
 
 #ifdef __cplusplus
 extern "C" {
@@ -74,6 +113,155 @@ extern "C" {
  */
 merve_analysis merve_parse_commonjs(const char* input, size_t length);
 
+/**
+ * Parse CommonJS source code that must be valid UTF-8.
+ *
+ * Same as merve_parse_commonjs(), but fails with MERVE_ERROR_INVALID_UTF8
+ * unless the whole source is valid UTF-8, validating it in the same pass as
+ * lexing.
+ *
+ * @param input  Pointer to the JavaScript source (need not be null-terminated).
+ *               NULL is treated as an empty string.
+ * @param length Length of the input in bytes.
+ * @return A handle to the parse result, or NULL on out-of-memory.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parse_commonjs_validated(const char* input, size_t length);
+
+/**
+ * Parse CommonJS source code held as Latin-1, without converting it first.
+ *
+ * ASCII export names point into the source, which must remain valid while
+ * they are used, as with merve_parse_commonjs(). Names containing bytes
+ * >= 0x80 are converted to UTF-8 and owned by the handle.
+ *
+ * @param input  Pointer to the Latin-1 source (need not be null-terminated).
+ *               NULL is treated as an empty string.
+ * @param length Length of the input in bytes.
+ * @return A handle to the parse result, or NULL on out-of-memory.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parse_commonjs_latin1(const char* input, size_t length);
+
+/**
+ * Parse CommonJS source code held as UTF-16, without converting it first.
+ *
+ * Export names are converted to UTF-8 and owned by the handle, so the
+ * source may be freed right after the call. Names containing a lone
+ * surrogate are skipped. merve_get_error_offset() counts UTF-16 code units.
+ *
+ * @param input  Pointer to the UTF-16 source, in native byte order.
+ *               NULL is treated as an empty string.
+ * @param length Length of the input in code units.
+ * @return A handle to the parse result, or NULL on out-of-memory.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parse_commonjs_utf16(const uint16_t* input, size_t length);
+
+/**
+ * Parse a CommonJS file without copying it into memory first.
+ *
+ * Regular files are mapped read-only and parsed in place; the handle keeps
+ * the mapping alive, so export names stay valid until merve_free(). The file
+ * must not be truncated in the meantime.
+ *
+ * @param path UTF-8 encoded path of the file.
+ * @return A handle to the parse result, or NULL if `path` is NULL, the file
+ *         cannot be read, or on out-of-memory.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parse_commonjs_file(const char* path);
+
+/**
+ * Parse CommonJS source code into a result that owns the source.
+ *
+ * The handle takes over the source buffer, so export names stay valid until
+ * merve_free() without the caller keeping the buffer alive. `release` is
+ * called with `context` exactly once, when the result no longer needs the
+ * buffer: right away if parsing fails or the handle cannot be allocated,
+ * otherwise from merve_free().
+ *
+ * @param input Pointer to the JavaScript source (need not be
+ *              null-terminated). NULL is treated as an empty string.
+ * @param length Length of the input in bytes.
+ * @param release Called to release the buffer. May be NULL.
+ * @param context Passed to `release`, e.g. the buffer itself.
+ * @return A handle to the parse result, or NULL on out-of-memory.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parse_commonjs_shared(const char* input, size_t length,
+                                           merve_release_callback release,
+                                           void* context);
+
+/**
+ * Parse CommonJS source code into caller-provided buffers.
+ *
+ * Writes the exports followed by the re-exports to `out`. Names that did
+ * not need unescaping point into the source, which must remain valid while
+ * they are used; the others are copied into `string_buf`, which is not
+ * null-terminated. Each thread keeps one parser for these calls, so once it
+ * has seen modules of a given size, parsing allocates nothing.
+ *
+ * When `out` or `string_buf` is too small, nothing useful is written and
+ * `info` holds the required sizes: call again with at least
+ * exports_count + reexports_count entries and string_length bytes.
+ *
+ * @param input           Pointer to the JavaScript source (need not be
+ *                        null-terminated). NULL is treated as an empty string.
+ * @param length          Length of the input in bytes.
+ * @param out             Array of `capacity` entries. May be NULL if
+ *                        `capacity` is 0.
+ * @param capacity        Number of entries in `out`.
+ * @param string_buf      Buffer of `string_capacity` bytes. May be NULL if
+ *                        `string_capacity` is 0.
+ * @param string_capacity Size of `string_buf` in bytes.
+ * @param info            Receives the error code and required sizes. May be
+ *                        NULL.
+ * @return true if parsing succeeded and the results fit, false otherwise.
+ */
+bool merve_parse_commonjs_into(const char* input, size_t length,
+                               merve_export* out, size_t capacity,
+                               char* string_buf, size_t string_capacity,
+                               merve_result_info* info);
+
+/**
+ * Create a parser that keeps its memory between merve_parser_parse() calls.
+ *
+ * Parsing many modules with one parser avoids setting up a new lexer and
+ * new result storage for each of them. A parser is not thread-safe; use one
+ * per thread.
+ *
+ * You must call merve_parser_free() on the returned handle when done.
+ *
+ * @return A parser handle, or NULL on out-of-memory.
+ */
+merve_parser merve_parser_create(void);
+
+/**
+ * Parse CommonJS source code with a reusable parser.
+ *
+ * The returned handle is owned by the parser: it is valid until the next
+ * merve_parser_parse() or merve_parser_free() call on the same parser, and
+ * passing it to merve_free() is a no-op. All other merve_analysis functions
+ * accept it.
+ *
+ * @param parser Handle returned by merve_parser_create(). NULL returns NULL.
+ * @param input  Pointer to the JavaScript source (need not be null-terminated).
+ *               NULL is treated as an empty string.
+ * @param length Length of the input in bytes.
+ * @return A handle to the parse result, or NULL if parser is NULL.
+ *         Use merve_is_valid() to check if parsing succeeded.
+ */
+merve_analysis merve_parser_parse(merve_parser parser, const char* input,
+                                  size_t length);
+
+/**
+ * Free a parser and the result of its last merve_parser_parse() call.
+ *
+ * @param parser Handle returned by merve_parser_create(). NULL is a no-op.
+ */
+void merve_parser_free(merve_parser parser);
+
 /**
  * Check whether the parse result is valid (parsing succeeded).
  *
@@ -82,10 +270,43 @@ merve_analysis merve_parse_commonjs(const char* input, size_t length);
  */
 bool merve_is_valid(merve_analysis result);
 
+/**
+ * Get the error that made a parse fail.
+ *
+ * Unlike merve_get_last_error(), the error is stored in the result, so it
+ * stays correct when other parses happen in between or the result is
+ * checked on another thread.
+ *
+ * @param result A parse result handle. NULL returns -1.
+ * @return One of the MERVE_ERROR_* constants, or -1 if parsing succeeded.
+ */
+int merve_get_error(merve_analysis result);
+
+/**
+ * Get the byte offset in the input at which the parse failed.
+ *
+ * Errors for brackets or templates left open are reported at the end of
+ * the input.
+ *
+ * @param result A parse result handle. NULL returns 0.
+ * @return Byte offset of the error, or 0 if parsing succeeded (check
+ *         merve_get_error() to tell that apart from an error at offset 0).
+ */
+size_t merve_get_error_offset(merve_analysis result);
+
+/**
+ * Get the line on which the parse failed.
+ *
+ * @param result A parse result handle. NULL returns 0.
+ * @return 1-based line number of the error, or 0 if parsing succeeded.
+ */
+uint32_t merve_get_error_line(merve_analysis result);
+
 /**
  * Free a parse result and all associated memory.
  *
- * @param result Handle returned by merve_parse_commonjs(). NULL is a no-op.
+ * @param result Handle returned by merve_parse_commonjs(). NULL and handles
+ *               returned by merve_parser_parse() are a no-op.
  */
 void merve_free(merve_analysis result);
 
@@ -142,7 +363,44 @@ merve_string merve_get_reexport_name(merve_analysis result, size_t index);
 uint32_t merve_get_reexport_line(merve_analysis result, size_t index);
 
 /**
- * Get the error code from the last merve_parse_commonjs() call.
+ * Copy the names and line numbers of consecutive exports in one call.
+ *
+ * Equivalent to calling merve_get_export_name() and merve_get_export_line()
+ * for indices start, start + 1, ... but without a call per export.
+ *
+ * @param result   A valid parse result handle.
+ * @param start    Index of the first export to copy.
+ * @param names    Receives up to `capacity` names, or NULL to skip names.
+ * @param lines    Receives up to `capacity` 1-based line numbers, or NULL to
+ *                 skip lines.
+ * @param capacity Number of entries in `names` and `lines`.
+ * @return Number of exports copied: the smaller of `capacity` and the
+ *         exports from `start` on. 0 if result is NULL or invalid.
+ */
+size_t merve_get_exports(merve_analysis result, size_t start,
+                         merve_string* names, uint32_t* lines,
+                         size_t capacity);
+
+/**
+ * Copy the specifiers and line numbers of consecutive re-exports in one call.
+ *
+ * The re-export counterpart of merve_get_exports().
+ *
+ * @param result   A valid parse result handle.
+ * @param start    Index of the first re-export to copy.
+ * @param names    Receives up to `capacity` specifiers, or NULL to skip them.
+ * @param lines    Receives up to `capacity` 1-based line numbers, or NULL to
+ *                 skip lines.
+ * @param capacity Number of entries in `names` and `lines`.
+ * @return Number of re-exports copied, 0 if result is NULL or invalid.
+ */
+size_t merve_get_reexports(merve_analysis result, size_t start,
+                           merve_string* names, uint32_t* lines,
+                           size_t capacity);
+
+/**
+ * Get the error code from the last merve_parse_commonjs() or
+ * merve_parser_parse() call.
  *
  * @return One of the MERVE_ERROR_* constants, or -1 if the last parse
  *         succeeded.
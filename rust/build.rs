@@ -82,7 +82,8 @@ fn ndk_major_version(ndk_dir: &Path) -> u32 {
     captures[1].parse().expect("could not parse major version")
 }
 
-/// Recursively inline `#include "..."` directives, deduplicating by file name.
+/// Recursively inline `#include "..."` directives, deduplicating by file name
+/// except for files under `generic/`.
 fn amalgamate_file(
     include_path: &Path,
     source_path: &Path,
@@ -103,7 +104,10 @@ fn amalgamate_file(
         if let Some(caps) = include_re.captures(line) {
             let inc_file = caps[1].to_string();
 
-            if included.contains(&inc_file) {
+            // src/generic files are compiled once per SIMD implementation,
+            // so they are inlined every time they are included.
+            let reincluded = inc_file.starts_with("generic/");
+            if included.contains(&inc_file) && !reincluded {
                 continue;
             }
 
@@ -111,7 +115,9 @@ fn amalgamate_file(
                 included.push(inc_file.clone());
                 Some((include_path.to_path_buf(), inc_file))
             } else if source_path.join(&inc_file).exists() {
-                included.push(inc_file.clone());
+                if !reincluded {
+                    included.push(inc_file.clone());
+                }
                 Some((source_path.to_path_buf(), inc_file))
             } else {
                 // System or unrecognized include — keep as-is.
@@ -159,9 +165,9 @@ fn amalgamate_from_repo(project_root: &Path, deps: &Path) {
     );
     fs::write(deps.join("merve.h"), &header).expect("failed to write deps/merve.h");
 
-    // 2. Amalgamate merve.cpp (parser.cpp + merve_c.cpp with includes resolved).
+    // 2. Amalgamate merve.cpp (parser.cpp + scan.cpp + merve_c.cpp + batch.cpp + file.cpp + cache.cpp + disk_cache.cpp with includes resolved).
     let mut source = String::from("#include \"merve.h\"\n\n");
-    for cpp in &["parser.cpp", "merve_c.cpp"] {
+    for cpp in &["parser.cpp", "scan.cpp", "merve_c.cpp", "batch.cpp", "file.cpp", "cache.cpp", "disk_cache.cpp"] {
         amalgamate_file(
             &include_path,
             &source_path,
@@ -194,9 +200,28 @@ fn main() {
         // Rebuild when upstream C++ sources change.
         for src in &[
             "src/parser.cpp",
+            "src/last_error.h",
+            "src/scan.h",
+            "src/scan.cpp",
+            "src/isadetection.h",
+            "src/generic/scan_kernels.h",
+            "src/simd/avx2.h",
+            "src/simd/avx512.h",
+            "src/simd/neon.h",
+            "src/simd/sse42.h",
             "src/merve_c.cpp",
+            "src/batch.cpp",
+            "src/file.cpp",
+            "src/cache.cpp",
+            "src/file_contents.h",
+            "src/disk_cache.cpp",
             "include/merve.h",
             "include/merve_c.h",
+            "include/merve/batch.h",
+            "include/merve/cache.h",
+            "include/merve/disk_cache.h",
+            "include/merve/file.h",
+            "include/merve/implementation.h",
             "include/merve/parser.h",
             "include/merve/version.h",
         ] {
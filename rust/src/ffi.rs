@@ -9,6 +9,7 @@ use core::ffi::{c_char, c_int, c_void};
 /// - The `merve_analysis` handle that produced it has not been freed.
 /// - For `string_view`-backed exports: the original source buffer is alive.
 #[repr(C)]
+#[derive(Clone, Copy)]
 pub struct merve_string {
     pub data: *const c_char,
     pub length: usize,
@@ -28,6 +29,7 @@ pub struct merve_version_components {
 unsafe extern "C" {
     pub fn merve_parse_commonjs(input: *const c_char, length: usize) -> merve_analysis;
     pub fn merve_is_valid(result: merve_analysis) -> bool;
+    pub fn merve_get_error(result: merve_analysis) -> c_int;
     pub fn merve_free(result: merve_analysis);
     pub fn merve_get_exports_count(result: merve_analysis) -> usize;
     pub fn merve_get_reexports_count(result: merve_analysis) -> usize;
@@ -35,6 +37,20 @@ unsafe extern "C" {
     pub fn merve_get_export_line(result: merve_analysis, index: usize) -> u32;
     pub fn merve_get_reexport_name(result: merve_analysis, index: usize) -> merve_string;
     pub fn merve_get_reexport_line(result: merve_analysis, index: usize) -> u32;
+    pub fn merve_get_exports(
+        result: merve_analysis,
+        start: usize,
+        names: *mut merve_string,
+        lines: *mut u32,
+        capacity: usize,
+    ) -> usize;
+    pub fn merve_get_reexports(
+        result: merve_analysis,
+        start: usize,
+        names: *mut merve_string,
+        lines: *mut u32,
+        capacity: usize,
+    ) -> usize;
     pub fn merve_get_last_error() -> c_int;
     pub fn merve_get_version() -> *const c_char;
     pub fn merve_get_version_components() -> merve_version_components;
@@ -52,6 +52,8 @@ pub enum LexerError {
     UnexpectedEsmImport,
     UnexpectedEsmExport,
     TemplateNestOverflow,
+    InvalidUtf8,
+    SourceTooLarge,
     /// An error code not recognized by these bindings.
     Unknown(i32),
 }
@@ -74,6 +76,8 @@ impl LexerError {
             10 => Self::UnexpectedEsmImport,
             11 => Self::UnexpectedEsmExport,
             12 => Self::TemplateNestOverflow,
+            13 => Self::InvalidUtf8,
+            14 => Self::SourceTooLarge,
             other => Self::Unknown(other),
         }
     }
@@ -95,6 +99,8 @@ impl LexerError {
             Self::UnexpectedEsmImport => "unexpected ESM import",
             Self::UnexpectedEsmExport => "unexpected ESM export",
             Self::TemplateNestOverflow => "template nesting overflow",
+            Self::InvalidUtf8 => "invalid UTF-8",
+            Self::SourceTooLarge => "source too large",
             Self::Unknown(_) => "unknown error",
         }
     }
@@ -211,23 +217,13 @@ impl<'a> Analysis<'a> {
     /// Iterate over all named exports.
     #[must_use]
     pub fn exports(&self) -> ExportIter<'a, '_> {
-        ExportIter {
-            analysis: self,
-            kind: ExportKind::Export,
-            index: 0,
-            count: self.exports_count(),
-        }
+        ExportIter::new(self, ExportKind::Export, self.exports_count())
     }
 
     /// Iterate over all re-exports.
     #[must_use]
     pub fn reexports(&self) -> ExportIter<'a, '_> {
-        ExportIter {
-            analysis: self,
-            kind: ExportKind::ReExport,
-            index: 0,
-            count: self.reexports_count(),
-        }
+        ExportIter::new(self, ExportKind::ReExport, self.reexports_count())
     }
 }
 
@@ -262,14 +258,58 @@ enum ExportKind {
     ReExport,
 }
 
+/// Number of entries [`ExportIter`] fetches from the C API per call.
+const EXPORT_BATCH: usize = 32;
+
 /// Iterator over exports or re-exports.
 ///
-/// Created by [`Analysis::exports`] or [`Analysis::reexports`].
+/// Created by [`Analysis::exports`] or [`Analysis::reexports`]. Entries are
+/// fetched in batches, one C API call per batch.
 pub struct ExportIter<'a, 'b> {
     analysis: &'b Analysis<'a>,
     kind: ExportKind,
     index: usize,
     count: usize,
+    // Entries `batch_start..batch_start + batch_len`.
+    batch_start: usize,
+    batch_len: usize,
+    names: [ffi::merve_string; EXPORT_BATCH],
+    lines: [u32; EXPORT_BATCH],
+}
+
+impl<'a, 'b> ExportIter<'a, 'b> {
+    fn new(analysis: &'b Analysis<'a>, kind: ExportKind, count: usize) -> Self {
+        ExportIter {
+            analysis,
+            kind,
+            index: 0,
+            count,
+            batch_start: 0,
+            batch_len: 0,
+            names: [ffi::merve_string {
+                data: core::ptr::null(),
+                length: 0,
+            }; EXPORT_BATCH],
+            lines: [0; EXPORT_BATCH],
+        }
+    }
+
+    fn fetch_batch(&mut self) {
+        let fetch = match self.kind {
+            ExportKind::Export => ffi::merve_get_exports,
+            ExportKind::ReExport => ffi::merve_get_reexports,
+        };
+        self.batch_start = self.index;
+        self.batch_len = unsafe {
+            fetch(
+                self.analysis.handle,
+                self.index,
+                self.names.as_mut_ptr(),
+                self.lines.as_mut_ptr(),
+                EXPORT_BATCH,
+            )
+        };
+    }
 }
 
 impl<'a, 'b> Iterator for ExportIter<'a, 'b> {
@@ -279,26 +319,15 @@ impl<'a, 'b> Iterator for ExportIter<'a, 'b> {
         if self.index >= self.count {
             return None;
         }
-        let i = self.index;
+        if self.index >= self.batch_start + self.batch_len {
+            self.fetch_batch();
+            assert!(self.batch_len > 0, "invariant: index is in bounds");
+        }
+        let i = self.index - self.batch_start;
         self.index += 1;
-        let (name, line) = match self.kind {
-            ExportKind::Export => (
-                self.analysis
-                    .export_name(i)
-                    .expect("invariant: export index is in bounds"),
-                self.analysis
-                    .export_line(i)
-                    .expect("invariant: export line is non-zero and in bounds"),
-            ),
-            ExportKind::ReExport => (
-                self.analysis
-                    .reexport_name(i)
-                    .expect("invariant: re-export index is in bounds"),
-                self.analysis
-                    .reexport_line(i)
-                    .expect("invariant: re-export line is non-zero and in bounds"),
-            ),
-        };
+        let analysis: &'b Analysis<'a> = self.analysis;
+        let name = analysis.str_from_ffi(self.names[i]);
+        let line = NonZeroU32::new(self.lines[i]).expect("invariant: line is non-zero");
         Some(Export { name, line })
     }
 
@@ -361,7 +390,7 @@ pub fn parse_commonjs(source: &str) -> Result<Analysis<'_>, LexerError> {
         });
     }
     if !unsafe { ffi::merve_is_valid(handle) } {
-        let code = unsafe { ffi::merve_get_last_error() };
+        let code = unsafe { ffi::merve_get_error(handle) };
         let err = if code >= 0 {
             LexerError::from_code(code)
         } else {
@@ -458,6 +487,12 @@ mod tests {
         assert_eq!(err, LexerError::UnexpectedEsmImport);
     }
 
+    #[test]
+    fn unterminated_paren_returns_error() {
+        let result = parse_commonjs("exports.a = (1");
+        assert_eq!(result.unwrap_err(), LexerError::UnterminatedParen);
+    }
+
     #[test]
     fn esm_export_returns_error() {
         let source = "export const x = 1;";
@@ -512,6 +547,21 @@ mod tests {
         assert_eq!(iter.len(), 3);
     }
 
+    #[cfg(feature = "std")]
+    #[test]
+    fn exports_iterator_spans_batches() {
+        let source: String = (0..100).map(|i| format!("exports.e{i} = {i};\n")).collect();
+        let analysis = parse_commonjs(&source).expect("should parse");
+        let mut iter = analysis.exports();
+        for i in 0..100 {
+            assert_eq!(iter.len(), 100 - i);
+            let export = iter.next().expect("should have an export");
+            assert_eq!(export.name, format!("e{i}"));
+            assert_eq!(Some(export.line), analysis.export_line(i));
+        }
+        assert!(iter.next().is_none());
+    }
+
     #[cfg(feature = "std")]
     #[test]
     fn reexports_iterator() {
@@ -560,7 +610,7 @@ mod tests {
 
     #[test]
     fn error_from_code_roundtrip() {
-        for code in 0..=12 {
+        for code in 0..=14 {
             let err = LexerError::from_code(code);
             assert_ne!(err, LexerError::Unknown(code));
         }
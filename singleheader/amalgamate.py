@@ -34,7 +34,7 @@ else:
     AMALGAMATE_OUTPUT_PATH = os.environ["AMALGAMATE_OUTPUT_PATH"]
 
 # this list excludes the "src/generic headers"
-ALLCFILES = ["parser.cpp", "merve_c.cpp"]
+ALLCFILES = ["parser.cpp", "scan.cpp", "merve_c.cpp", "batch.cpp", "file.cpp", "cache.cpp", "disk_cache.cpp"]
 
 # order matters
 ALLCHEADERS = ["merve.h"]
@@ -59,7 +59,11 @@ def doinclude(fid: str, file: str, line: str, origin: str) -> None:
         else:
             pass
     elif os.path.exists(pi):
-        if file not in found_includes:
+        # src/generic files are compiled once per SIMD implementation, so
+        # they are inlined every time they are included.
+        if file.startswith("generic/"):
+            dofile(fid, AMALGAMATE_SOURCE_PATH, file)
+        elif file not in found_includes:
             found_includes.append(file)
             dofile(fid, AMALGAMATE_SOURCE_PATH, file)
         else:
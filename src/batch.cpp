@@ -0,0 +1,159 @@
+#include "merve/batch.h"
+#include "last_error.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+// WebAssembly without the atomics feature has no threads: parse on the
+// calling thread only.
+#if !defined(MERVE_NO_THREADS) && defined(__wasm__) && !defined(__wasm_atomics__)
+#define MERVE_NO_THREADS 1
+#endif
+
+#ifndef MERVE_NO_THREADS
+#include <mutex>
+#include <system_error>
+#include <thread>
+#endif
+
+namespace lexer {
+
+namespace {
+
+// Each worker lexes with its own parser, which keeps the lexer and its
+// vectors from one input to the next; results are copies sized exactly.
+void parse_one(parser& lexer, std::span<const std::string_view> inputs, std::vector<batch_result>& results,
+               size_t index) {
+  if (const lexer_analysis* analysis = lexer.parse(inputs[index])) {
+    results[index].analysis = *analysis;
+  } else {
+    results[index].error = last_error;
+    results[index].location = last_error_location;
+  }
+}
+
+#ifndef MERVE_NO_THREADS
+
+// The inputs a worker has left, [next, end). The owner takes them from the
+// front; other workers steal the back half once they run out.
+struct work_range {
+  std::mutex mutex{};
+  size_t next = 0;
+  size_t end = 0;
+};
+
+bool take(work_range& range, size_t& index) {
+  std::lock_guard<std::mutex> lock(range.mutex);
+  if (range.next == range.end) {
+    return false;
+  }
+  index = range.next++;
+  return true;
+}
+
+bool steal(work_range& victim, work_range& thief) {
+  size_t begin;
+  size_t end;
+  {
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    size_t left = victim.end - victim.next;
+    if (left == 0) {
+      return false;
+    }
+    end = victim.end;
+    begin = end - (left + 1) / 2;
+    victim.end = begin;
+  }
+  std::lock_guard<std::mutex> lock(thief.mutex);
+  thief.next = begin;
+  thief.end = end;
+  return true;
+}
+
+// Parses its own inputs, then steals until every other range is empty.
+// Inputs in flight between two ranges are parsed by the thief, so none is
+// missed when a worker gives up.
+void work(std::span<const std::string_view> inputs, std::vector<batch_result>& results,
+          std::vector<work_range>& ranges, size_t self) {
+  parser lexer;
+  for (;;) {
+    size_t index;
+    while (take(ranges[self], index)) {
+      parse_one(lexer, inputs, results, index);
+    }
+    bool stole = false;
+    for (size_t i = 1; i < ranges.size() && !stole; i++) {
+      stole = steal(ranges[(self + i) % ranges.size()], ranges[self]);
+    }
+    if (!stole) {
+      return;
+    }
+  }
+}
+
+// Starts a worker, or returns false if the system is out of threads. The
+// workers already running then steal the inputs of those that did not start.
+template <typename... Args>
+bool start_worker(std::vector<std::thread>& workers, Args&&... args) {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+  try {
+    workers.emplace_back(std::forward<Args>(args)...);
+  } catch (const std::system_error&) {
+    return false;
+  }
+#else
+  workers.emplace_back(std::forward<Args>(args)...);
+#endif
+  return true;
+}
+
+#endif  // MERVE_NO_THREADS
+
+}  // namespace
+
+std::vector<batch_result> parse_commonjs_batch(std::span<const std::string_view> inputs,
+                                               const batch_options& options) {
+  std::vector<batch_result> results(inputs.size());
+  // The calling thread parses too, but its last error is left alone.
+  std::optional<lexer_error> caller_error = last_error;
+  std::optional<error_location> caller_location = last_error_location;
+
+#ifndef MERVE_NO_THREADS
+  size_t threads = options.threads != 0 ? options.threads : std::thread::hardware_concurrency();
+  threads = std::min(threads, inputs.size());
+  if (threads > 1) {
+    std::vector<work_range> ranges(threads);
+    for (size_t i = 0; i < threads; i++) {
+      ranges[i].next = inputs.size() * i / threads;
+      ranges[i].end = inputs.size() * (i + 1) / threads;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t i = 1; i < threads; i++) {
+      if (!start_worker(workers, work, inputs, std::ref(results), std::ref(ranges), i)) {
+        break;
+      }
+    }
+    work(inputs, results, ranges, 0);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    last_error = caller_error;
+    last_error_location = caller_location;
+    return results;
+  }
+#else
+  (void)options;
+#endif
+
+  parser lexer;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    parse_one(lexer, inputs, results, i);
+  }
+  last_error = caller_error;
+  last_error_location = caller_location;
+  return results;
+}
+
+}  // namespace lexer
@@ -0,0 +1,253 @@
+#include "merve/cache.h"
+#include "last_error.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+// WebAssembly without the atomics feature has no threads: there is nothing
+// to lock.
+#if !defined(MERVE_NO_THREADS) && defined(__wasm__) && !defined(__wasm_atomics__)
+#define MERVE_NO_THREADS 1
+#endif
+
+#ifndef MERVE_NO_THREADS
+#include <mutex>
+#include <thread>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace lexer {
+
+namespace {
+
+// ============================================================================
+// Hashing
+// ============================================================================
+
+constexpr uint64_t kHashSecret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+                                     0x589965cc75374cc3ull};
+
+// The 128-bit product of a and b, folded to 64 bits.
+inline uint64_t fold_multiply(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+  uint64_t high;
+  uint64_t low = _umul128(a, b, &high);
+  return low ^ high;
+#else
+  uint64_t a_low = a & 0xffffffff, a_high = a >> 32;
+  uint64_t b_low = b & 0xffffffff, b_high = b >> 32;
+  uint64_t low_low = a_low * b_low;
+  uint64_t high_low = a_high * b_low;
+  uint64_t low_high = a_low * b_high;
+  uint64_t high_high = a_high * b_high;
+  uint64_t cross = (low_low >> 32) + (high_low & 0xffffffff) + low_high;
+  uint64_t high = high_high + (high_low >> 32) + (cross >> 32);
+  uint64_t low = (cross << 32) | (low_low & 0xffffffff);
+  return low ^ high;
+#endif
+}
+
+inline uint64_t load64(const char* p) {
+  uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+// ============================================================================
+// Locking
+// ============================================================================
+
+#ifndef MERVE_NO_THREADS
+using shard_mutex = std::mutex;
+#else
+struct shard_mutex {
+  void lock() noexcept {}
+  void unlock() noexcept {}
+};
+#endif
+
+class shard_lock {
+ public:
+  explicit shard_lock(shard_mutex& mutex) : mutex_(mutex) { mutex_.lock(); }
+  ~shard_lock() { mutex_.unlock(); }
+  shard_lock(const shard_lock&) = delete;
+  shard_lock& operator=(const shard_lock&) = delete;
+
+ private:
+  shard_mutex& mutex_;
+};
+
+// The outcome of parsing one source, shared by the cache and its callers.
+struct cached_result {
+  compact_analysis analysis{};
+  std::optional<lexer_error> error{};  // Set if parsing failed
+  error_location location{};
+  size_t length = 0;  // Of the source, checked on hits
+};
+
+// The shard is picked by the high half of the hash, the bucket by the low.
+struct source_hash_hasher {
+  size_t operator()(const source_hash& hash) const noexcept { return static_cast<size_t>(hash.low); }
+};
+
+}  // namespace
+
+source_hash hash_source(std::string_view source) noexcept {
+  const char* p = source.data();
+  size_t length = source.size();
+  uint64_t a = kHashSecret[0];
+  uint64_t b = kHashSecret[1];
+  // Each step xors 16 bytes into two lanes and mixes them with a bijection
+  // of the lanes (odd multipliers, rotates and cross-lane xor and add), so
+  // no block can leave the state as it found it or cancel another.
+  auto step = [&a, &b](uint64_t x, uint64_t y) {
+    a = (a ^ x) * (kHashSecret[2] | 1);
+    b = (b ^ y) * (kHashSecret[3] | 1);
+    a ^= std::rotr(b, 29);
+    b += std::rotr(a, 31);
+  };
+  for (; length >= 16; p += 16, length -= 16) {
+    step(load64(p), load64(p + 8));
+  }
+  if (length > 0) {
+    // The length is mixed in below, so zero padding is unambiguous.
+    char tail[16] = {};
+    std::memcpy(tail, p, length);
+    step(load64(tail), load64(tail + 8));
+  }
+  uint64_t size = source.size();
+  uint64_t low = fold_multiply(a ^ kHashSecret[2], b ^ size ^ kHashSecret[0]);
+  uint64_t high = fold_multiply(b ^ kHashSecret[3], a ^ (size * kHashSecret[1]));
+  return source_hash{low, high};
+}
+
+struct analysis_cache::shard {
+  struct node {
+    source_hash key;
+    std::shared_ptr<const cached_result> result;
+  };
+
+  shard_mutex mutex{};
+  std::list<node> lru{};  // Most recently used first
+  std::unordered_map<source_hash, std::list<node>::iterator, source_hash_hasher> index{};
+  size_t capacity = 0;
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+
+analysis_cache::analysis_cache(size_t capacity, size_t shards) : shards_(), shard_count_(0) {
+  capacity = std::max<size_t>(capacity, 1);
+  if (shards == 0) {
+#ifndef MERVE_NO_THREADS
+    // A few more shards than threads keeps two threads from often picking
+    // the same one.
+    shards = std::max<size_t>(std::thread::hardware_concurrency(), 1) * 4;
+#else
+    shards = 1;
+#endif
+  }
+  shard_count_ = std::bit_floor(std::min(shards, capacity));
+  shards_ = std::make_unique<shard[]>(shard_count_);
+  for (size_t i = 0; i < shard_count_; i++) {
+    shards_[i].capacity = capacity / shard_count_ + (i < capacity % shard_count_ ? 1 : 0);
+  }
+}
+
+analysis_cache::~analysis_cache() = default;
+
+analysis_cache::shard& analysis_cache::shard_for(const source_hash& hash) const noexcept {
+  return shards_[hash.high & (shard_count_ - 1)];
+}
+
+std::shared_ptr<const compact_analysis> analysis_cache::parse(std::string_view source) {
+  source_hash key = hash_source(source);
+  shard& s = shard_for(key);
+  std::shared_ptr<const cached_result> result;
+  {
+    shard_lock lock(s.mutex);
+    auto found = s.index.find(key);
+    // A source of another length whose hash collides is a miss.
+    if (found != s.index.end() && found->second->result->length == source.size()) {
+      s.hits++;
+      s.lru.splice(s.lru.begin(), s.lru, found->second);
+      result = found->second->result;
+    }
+  }
+
+  if (!result) {
+    parse_result parsed = parse_commonjs_result(source);
+    auto fresh = std::make_shared<cached_result>();
+    fresh->length = source.size();
+    if (parsed) {
+      fresh->analysis = compact_analysis(*parsed);
+    } else {
+      fresh->error = parsed.error();
+      fresh->location = parsed.location();
+    }
+    result = std::move(fresh);
+
+    shard_lock lock(s.mutex);
+    s.misses++;
+    auto [slot, inserted] = s.index.try_emplace(key);
+    if (inserted) {
+      s.lru.push_front(shard::node{key, result});
+      slot->second = s.lru.begin();
+      while (s.lru.size() > s.capacity) {
+        s.index.erase(s.lru.back().key);
+        s.lru.pop_back();
+      }
+    } else {
+      // Another thread parsed the same source in the meantime, or the entry
+      // is for a colliding source, which this one replaces.
+      if (slot->second->result->length != source.size()) {
+        slot->second->result = result;
+      }
+      s.lru.splice(s.lru.begin(), s.lru, slot->second);
+    }
+  }
+
+  if (result->error) {
+    last_error = result->error;
+    last_error_location = result->location;
+    return nullptr;
+  }
+  last_error.reset();
+  last_error_location.reset();
+  // Shares ownership of the whole cached_result.
+  return std::shared_ptr<const compact_analysis>(result, &result->analysis);
+}
+
+cache_statistics analysis_cache::statistics() const {
+  cache_statistics total;
+  for (size_t i = 0; i < shard_count_; i++) {
+    shard& s = shards_[i];
+    shard_lock lock(s.mutex);
+    total.hits += s.hits;
+    total.misses += s.misses;
+    total.size += s.lru.size();
+  }
+  return total;
+}
+
+void analysis_cache::clear() {
+  for (size_t i = 0; i < shard_count_; i++) {
+    shard& s = shards_[i];
+    shard_lock lock(s.mutex);
+    s.index.clear();
+    s.lru.clear();
+    s.hits = 0;
+    s.misses = 0;
+  }
+}
+
+}  // namespace lexer
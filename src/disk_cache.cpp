@@ -0,0 +1,376 @@
+#include "merve/disk_cache.h"
+#include "merve/version.h"
+#include "file_contents.h"
+#include "last_error.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace lexer {
+
+namespace {
+
+// ============================================================================
+// File format
+// ============================================================================
+//
+// A file_header, then header.slot_count index_slots, then the records they
+// point to. Records start at multiples of 8 bytes. Every field is in the
+// byte order of the machine that wrote the file; the magic number tells a
+// file written with the other byte order apart.
+
+constexpr uint64_t kDiskCacheMagic = 0x32454843564d5245ull;  // "ERMVCHE2" read little-endian
+
+struct file_header {
+  uint64_t magic;
+  char version[24];      // MERVE_VERSION, NUL-padded
+  uint64_t slot_count;   // A power of two
+  uint64_t entry_count;  // Records in the file
+  uint64_t size;         // Of the whole file
+};
+
+// An open-addressing hash table slot, probed linearly from key.low.
+struct index_slot {
+  uint64_t low;
+  uint64_t high;
+  uint64_t offset;  // Of the record from the start of the file; 0 if empty
+};
+
+// Followed by export_count + reexport_count compact_export entries, whose
+// offsets are into the names_size bytes of names after them.
+struct record_header {
+  uint64_t source_length;  // Checked on lookups by source
+  uint32_t export_count;
+  uint32_t reexport_count;
+  uint32_t names_size;
+  uint32_t error;  // lexer_error + 1, or 0 if parsing succeeded
+  uint32_t error_offset;
+  uint32_t error_line;
+};
+
+static_assert(sizeof(file_header) % 8 == 0 && sizeof(index_slot) % 8 == 0);
+static_assert(alignof(compact_export) <= alignof(record_header));
+
+constexpr size_t round_up8(size_t size) {
+  return (size + 7) & ~size_t{7};
+}
+
+// The header of a cache file this version can read, or null.
+const file_header* valid_header(const file_contents& file) {
+  if (file.size < sizeof(file_header)) {
+    return nullptr;
+  }
+  const auto* header = reinterpret_cast<const file_header*>(file.data);
+  char version[sizeof(header->version)] = {};
+  std::strncpy(version, MERVE_VERSION, sizeof(version) - 1);
+  if (header->magic != kDiskCacheMagic || std::memcmp(header->version, version, sizeof(version)) != 0 ||
+      header->size != file.size || !std::has_single_bit(header->slot_count) ||
+      header->slot_count > (file.size - sizeof(file_header)) / sizeof(index_slot)) {
+    return nullptr;
+  }
+  return header;
+}
+
+const index_slot* slots_of(const file_header* header) {
+  return reinterpret_cast<const index_slot*>(header + 1);
+}
+
+// The size of the record at `record`, given `available` bytes from there
+// on, or 0 if it does not fit or refers outside itself.
+size_t record_size(const char* record, size_t available) {
+  if (available < sizeof(record_header)) {
+    return 0;
+  }
+  const auto* header = reinterpret_cast<const record_header*>(record);
+  size_t entry_count = size_t{header->export_count} + header->reexport_count;
+  if (entry_count > (available - sizeof(record_header)) / sizeof(compact_export)) {
+    return 0;
+  }
+  size_t size = sizeof(record_header) + entry_count * sizeof(compact_export);
+  if (header->names_size > available - size || header->error > lexer_error::SOURCE_TOO_LARGE + 1) {
+    return 0;
+  }
+  const auto* entries = reinterpret_cast<const compact_export*>(header + 1);
+  for (size_t i = 0; i < entry_count; i++) {
+    if (entries[i].offset > header->names_size || entries[i].length > header->names_size - entries[i].offset) {
+      return 0;
+    }
+  }
+  return std::min(round_up8(size + header->names_size), available);
+}
+
+// Encodes the outcome of parsing a source of `source_length` bytes as a
+// record.
+std::string encode_record(const parse_result& parsed, size_t source_length) {
+  record_header header{};
+  header.source_length = source_length;
+  std::string names;
+  std::vector<compact_export> entries;
+  if (parsed) {
+    header.export_count = static_cast<uint32_t>(parsed->exports.size());
+    header.reexport_count = static_cast<uint32_t>(parsed->re_exports.size());
+    entries.reserve(parsed->exports.size() + parsed->re_exports.size());
+    for (const auto* list : {&parsed->exports, &parsed->re_exports}) {
+      for (const auto& entry : *list) {
+        std::string_view name = get_string_view(entry);
+        entries.push_back(compact_export{static_cast<uint32_t>(names.size()), static_cast<uint32_t>(name.size()),
+                                         entry.line, 0});
+        names.append(name);
+      }
+    }
+    header.names_size = static_cast<uint32_t>(names.size());
+  } else {
+    header.error = static_cast<uint32_t>(parsed.error()) + 1;
+    header.error_offset = parsed.location().offset;
+    header.error_line = parsed.location().line;
+  }
+  std::string record(reinterpret_cast<const char*>(&header), sizeof(header));
+  record.append(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(compact_export));
+  record.append(names);
+  record.resize(round_up8(record.size()), '\0');
+  return record;
+}
+
+// A name for the temporary file save() writes next to `path`, unlikely to
+// be used by another process saving at the same time.
+std::filesystem::path temporary_path(const std::filesystem::path& path, const void* self) {
+  uint64_t stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  source_hash unique = hash_source(std::string_view(reinterpret_cast<const char*>(&stamp), sizeof(stamp)));
+  std::filesystem::path temporary = path;
+  temporary += ".tmp" + std::to_string(unique.low ^ reinterpret_cast<uintptr_t>(self));
+  return temporary;
+}
+
+// Windows cannot replace a file that is mapped, so a mapping kept open by
+// any cache would make every save() fail. Caches there read the file into
+// memory instead.
+#if defined(_WIN32)
+constexpr bool kMapCacheFile = false;
+#else
+constexpr bool kMapCacheFile = true;
+#endif
+
+struct disk_key_hasher {
+  size_t operator()(const source_hash& key) const noexcept { return static_cast<size_t>(key.low); }
+};
+
+// Sets the thread's last error from a cached outcome.
+std::optional<cached_analysis> report(const cached_analysis& analysis) {
+  if (analysis.error()) {
+    last_error = analysis.error();
+    last_error_location = analysis.location();
+    return std::nullopt;
+  }
+  last_error.reset();
+  last_error_location.reset();
+  return analysis;
+}
+
+}  // namespace
+
+struct disk_cache::state {
+  std::filesystem::path path;
+  // The cache file as it was when the cache was opened.
+  file_contents file{};
+  const file_header* header = nullptr;  // Null if the file is missing or unusable
+  // Records added since, in the file format. A deque, so views of them stay
+  // valid as more are added.
+  std::deque<std::pair<source_hash, std::string>> added{};
+  std::unordered_map<source_hash, size_t, disk_key_hasher> added_index{};
+  size_t new_keys = 0;  // Keys in added_index that are not in the file
+
+  explicit state(std::filesystem::path p) : path(std::move(p)) {}
+  ~state() { release_file(file); }
+  state(const state&) = delete;
+  state& operator=(const state&) = delete;
+};
+
+disk_cache::disk_cache(std::filesystem::path path) : state_(std::make_unique<state>(std::move(path))) {
+  std::error_code ec;
+  if (read_file(state_->path, state_->file, ec, kMapCacheFile)) {
+    state_->header = valid_header(state_->file);
+  }
+}
+
+disk_cache::~disk_cache() = default;
+disk_cache::disk_cache(disk_cache&& other) noexcept = default;
+disk_cache& disk_cache::operator=(disk_cache&& other) noexcept = default;
+
+cached_analysis disk_cache::view(const char* record) noexcept {
+  const auto* header = reinterpret_cast<const record_header*>(record);
+  const auto* entries = reinterpret_cast<const compact_export*>(header + 1);
+  size_t entry_count = size_t{header->export_count} + header->reexport_count;
+  std::optional<lexer_error> error;
+  if (header->error != 0) {
+    error = static_cast<lexer_error>(header->error - 1);
+  }
+  return cached_analysis(std::span<const compact_export>(entries, entry_count), header->export_count,
+                         reinterpret_cast<const char*>(entries + entry_count), error,
+                         error_location{header->error_offset, header->error_line});
+}
+
+std::optional<cached_analysis> disk_cache::find(const source_hash& key) const noexcept {
+  if (const char* found = find_record(key)) {
+    return view(found);
+  }
+  return std::nullopt;
+}
+
+const char* disk_cache::find_record(const source_hash& key) const noexcept {
+  if (!state_) {
+    return nullptr;
+  }
+  // Added records come first: they replace colliding ones in the file.
+  auto added = state_->added_index.find(key);
+  if (added != state_->added_index.end()) {
+    return state_->added[added->second].second.data();
+  }
+  if (const file_header* header = state_->header) {
+    const index_slot* slots = slots_of(header);
+    size_t mask = header->slot_count - 1;
+    size_t data_start = sizeof(file_header) + header->slot_count * sizeof(index_slot);
+    for (size_t i = key.low & mask, probes = 0; probes <= mask && slots[i].offset != 0; i = (i + 1) & mask, probes++) {
+      if (slots[i].low != key.low || slots[i].high != key.high) {
+        continue;
+      }
+      const index_slot& slot = slots[i];
+      if (slot.offset < data_start || slot.offset >= header->size || slot.offset % 8 != 0 ||
+          record_size(state_->file.data + slot.offset, header->size - slot.offset) == 0) {
+        return nullptr;  // Damaged
+      }
+      return state_->file.data + slot.offset;
+    }
+  }
+  return nullptr;
+}
+
+std::optional<cached_analysis> disk_cache::parse(std::string_view source) {
+  return parse(hash_source(source), source);
+}
+
+std::optional<cached_analysis> disk_cache::parse(const source_hash& key, std::string_view source) {
+  if (!state_) {
+    // Moved from: start over, in memory only.
+    state_ = std::make_unique<state>(std::filesystem::path());
+  }
+  const char* cached = find_record(key);
+  // A record for a source of another length is a collision, which the new
+  // record replaces. The old one stays, as views of it may be in use.
+  if (cached && reinterpret_cast<const record_header*>(cached)->source_length == source.size()) {
+    return report(view(cached));
+  }
+  if (!cached) {
+    state_->new_keys++;
+  }
+  state_->added_index.insert_or_assign(key, state_->added.size());
+  state_->added.emplace_back(key, encode_record(parse_commonjs_result(source), source.size()));
+  return report(view(state_->added.back().second.data()));
+}
+
+size_t disk_cache::size() const noexcept {
+  if (!state_) {
+    return 0;
+  }
+  return (state_->header ? state_->header->entry_count : 0) + state_->new_keys;
+}
+
+bool disk_cache::save(std::error_code& ec) const {
+  ec.clear();
+  if (!state_ || state_->path.empty()) {
+    ec = std::make_error_code(std::errc::invalid_argument);
+    return false;
+  }
+  // Start from the file as it is now, which another process may have
+  // replaced since this cache was opened.
+  file_contents current{};
+  std::error_code read_error;
+  const file_header* current_header = nullptr;
+  if (read_file(state_->path, current, read_error)) {
+    current_header = valid_header(current);
+  }
+
+  // Added records win over those on disk, and later ones over earlier ones
+  // with the same key.
+  std::vector<std::pair<source_hash, std::string_view>> records;
+  std::unordered_map<source_hash, size_t, disk_key_hasher> seen;
+  for (auto added = state_->added.rbegin(); added != state_->added.rend(); ++added) {
+    if (seen.emplace(added->first, 0).second) {
+      records.emplace_back(added->first, added->second);
+    }
+  }
+  if (current_header) {
+    const index_slot* slots = slots_of(current_header);
+    size_t data_start = sizeof(file_header) + current_header->slot_count * sizeof(index_slot);
+    for (size_t i = 0; i < current_header->slot_count; i++) {
+      const index_slot& slot = slots[i];
+      if (slot.offset < data_start || slot.offset >= current_header->size || slot.offset % 8 != 0) {
+        continue;
+      }
+      size_t size = record_size(current.data + slot.offset, current_header->size - slot.offset);
+      source_hash key{slot.low, slot.high};
+      if (size != 0 && seen.emplace(key, 0).second) {
+        records.emplace_back(key, std::string_view(current.data + slot.offset, size));
+      }
+    }
+  }
+
+  // At most half full, so probes stay short.
+  size_t slot_count = std::bit_ceil(std::max<size_t>(16, records.size() * 2));
+  std::vector<index_slot> slots(slot_count, index_slot{0, 0, 0});
+  uint64_t offset = sizeof(file_header) + slot_count * sizeof(index_slot);
+  for (const auto& [key, record] : records) {
+    size_t i = key.low & (slot_count - 1);
+    while (slots[i].offset != 0) {
+      i = (i + 1) & (slot_count - 1);
+    }
+    slots[i] = index_slot{key.low, key.high, offset};
+    offset += record.size();
+  }
+  file_header header{};
+  header.magic = kDiskCacheMagic;
+  std::strncpy(header.version, MERVE_VERSION, sizeof(header.version) - 1);
+  header.slot_count = slot_count;
+  header.entry_count = records.size();
+  header.size = offset;
+
+  std::filesystem::path temporary = temporary_path(state_->path, this);
+  if (state_->path.has_parent_path()) {
+    std::error_code ignored;
+    std::filesystem::create_directories(state_->path.parent_path(), ignored);
+  }
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(slots.data()), static_cast<std::streamsize>(slots.size() * sizeof(index_slot)));
+    for (const auto& record : records) {
+      out.write(record.second.data(), static_cast<std::streamsize>(record.second.size()));
+    }
+    out.close();
+    if (!out) {
+      ec = std::make_error_code(std::errc::io_error);
+    }
+  }
+  release_file(current);
+  // Flush before renaming, or a crash could leave a truncated file under
+  // the real name.
+  if (!ec && sync_file(temporary, ec)) {
+    // Atomically replaces the old file. Readers keep their mapping of it on
+    // POSIX systems and their copy of it on Windows, see kMapCacheFile.
+    std::filesystem::rename(temporary, state_->path, ec);
+  }
+  if (ec) {
+    std::error_code ignored;
+    std::filesystem::remove(temporary, ignored);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace lexer
@@ -0,0 +1,272 @@
+#include "merve/file.h"
+#include "file_contents.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__wasi__)
+#define MERVE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#endif
+
+namespace lexer {
+
+namespace {
+
+// Reads a file that cannot be mapped, such as a pipe, into a heap buffer.
+// `read_some` fills up to `n` bytes at `p` and returns how many it read, 0 at
+// the end of the file or -1 on error.
+template <typename ReadSome>
+bool read_all(ReadSome read_some, file_contents& out) {
+  size_t capacity = 64 * 1024;
+  std::unique_ptr<char[]> buffer(new char[capacity]);
+  size_t size = 0;
+  for (;;) {
+    if (size == capacity) {
+      std::unique_ptr<char[]> grown(new char[capacity * 2]);
+      std::memcpy(grown.get(), buffer.get(), size);
+      buffer = std::move(grown);
+      capacity *= 2;
+    }
+    long long n = read_some(buffer.get() + size, capacity - size);
+    if (n < 0) {
+      return false;
+    }
+    if (n == 0) {
+      break;
+    }
+    size += static_cast<size_t>(n);
+  }
+  out.data = buffer.release();
+  out.size = size;
+  out.mapped = false;
+  return true;
+}
+
+}  // namespace
+
+#if defined(_WIN32)
+
+bool read_file(const std::filesystem::path& path, file_contents& out, std::error_code& ec, bool map) {
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    ec.assign(static_cast<int>(GetLastError()), std::system_category());
+    return false;
+  }
+  bool ok = true;
+  LARGE_INTEGER size{};
+  if (!map || GetFileType(file) != FILE_TYPE_DISK) {
+    ok = read_all(
+        [file](char* p, size_t n) -> long long {
+          DWORD read = 0;
+          DWORD chunk = n > MAXDWORD ? MAXDWORD : static_cast<DWORD>(n);
+          if (!ReadFile(file, p, chunk, &read, nullptr)) {
+            return GetLastError() == ERROR_BROKEN_PIPE ? 0 : -1;
+          }
+          return read;
+        },
+        out);
+  } else if (!GetFileSizeEx(file, &size)) {
+    ok = false;
+  } else if (size.QuadPart > 0) {
+    // A mapping cannot be empty: empty files keep the null contents.
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    ok = view != nullptr;
+    if (ok) {
+      out.data = static_cast<const char*>(view);
+      out.size = static_cast<size_t>(size.QuadPart);
+      out.mapped = true;
+    }
+    if (mapping) {
+      CloseHandle(mapping);
+    }
+  }
+  if (!ok) {
+    ec.assign(static_cast<int>(GetLastError()), std::system_category());
+  }
+  CloseHandle(file);
+  return ok;
+}
+
+#elif defined(MERVE_HAS_MMAP)
+
+bool read_file(const std::filesystem::path& path, file_contents& out, std::error_code& ec, bool map) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    ec.assign(errno, std::generic_category());
+    return false;
+  }
+  bool ok = true;
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ok = false;
+  } else if (!map || !S_ISREG(st.st_mode)) {
+    ok = read_all(
+        [fd](char* p, size_t n) -> long long {
+          ssize_t read;
+          do {
+            read = ::read(fd, p, n);
+          } while (read < 0 && errno == EINTR);
+          return read;
+        },
+        out);
+  } else if (static_cast<unsigned long long>(st.st_size) > SIZE_MAX) {
+    errno = EFBIG;
+    ok = false;
+  } else if (st.st_size > 0) {
+    // A mapping cannot be empty: empty files keep the null contents.
+    size_t size = static_cast<size_t>(st.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ok = data != MAP_FAILED;
+    if (ok) {
+      // The lexer reads the file once, front to back: let the kernel read
+      // ahead aggressively and drop pages behind it. Only a hint.
+      ::posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+      out.data = static_cast<const char*>(data);
+      out.size = size;
+      out.mapped = true;
+    }
+  }
+  if (!ok) {
+    ec.assign(errno, std::generic_category());
+  }
+  ::close(fd);
+  return ok;
+}
+
+#else
+
+bool read_file(const std::filesystem::path& path, file_contents& out, std::error_code& ec, bool /* map */) {
+  std::FILE* file = std::fopen(path.string().c_str(), "rb");
+  if (file == nullptr) {
+    ec.assign(errno, std::generic_category());
+    return false;
+  }
+  bool ok = read_all(
+      [file](char* p, size_t n) -> long long {
+        size_t read = std::fread(p, 1, n, file);
+        return read == 0 && std::ferror(file) ? -1 : static_cast<long long>(read);
+      },
+      out);
+  if (!ok) {
+    ec.assign(errno, std::generic_category());
+  }
+  std::fclose(file);
+  return ok;
+}
+
+#endif
+
+bool sync_file(const std::filesystem::path& path, std::error_code& ec) {
+#if defined(_WIN32)
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  bool ok = file != INVALID_HANDLE_VALUE && FlushFileBuffers(file);
+  if (!ok) {
+    ec.assign(static_cast<int>(GetLastError()), std::system_category());
+  }
+  if (file != INVALID_HANDLE_VALUE) {
+    CloseHandle(file);
+  }
+  return ok;
+#elif defined(MERVE_HAS_MMAP)
+  // fsync() flushes the file, not just what was written through `fd`.
+  int fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+  bool ok = fd >= 0 && ::fsync(fd) == 0;
+  if (!ok) {
+    ec.assign(errno, std::generic_category());
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+  return ok;
+#else
+  // No portable way to flush a file by path.
+  (void)path;
+  ec.clear();
+  return true;
+#endif
+}
+
+void release_file(const file_contents& contents) noexcept {
+  if (contents.data == nullptr) {
+    return;
+  }
+  if (contents.mapped) {
+#if defined(_WIN32)
+    UnmapViewOfFile(contents.data);
+#elif defined(MERVE_HAS_MMAP)
+    ::munmap(const_cast<char*>(contents.data), contents.size);
+#endif
+  } else {
+    delete[] contents.data;
+  }
+}
+
+file_analysis::file_analysis(file_analysis&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_(other.mapped_),
+      analysis_(std::move(other.analysis_)) {}
+
+file_analysis& file_analysis::operator=(file_analysis&& other) noexcept {
+  if (this != &other) {
+    release();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    mapped_ = other.mapped_;
+    analysis_ = std::move(other.analysis_);
+  }
+  return *this;
+}
+
+file_analysis::~file_analysis() {
+  release();
+}
+
+void file_analysis::release() noexcept {
+  release_file(file_contents{data_, size_, mapped_});
+  data_ = nullptr;
+  size_ = 0;
+}
+
+std::optional<file_analysis> parse_commonjs_file(const std::filesystem::path& path, std::error_code& ec) {
+  ec.clear();
+  file_contents contents;
+  if (!read_file(path, contents, ec)) {
+    return std::nullopt;
+  }
+  // Owns the contents from here on, also if parsing fails.
+  file_analysis file(contents.data, contents.size, contents.mapped);
+  std::optional<lexer_analysis> analysis = parse_commonjs(file.source());
+  if (!analysis) {
+    return std::nullopt;
+  }
+  file.analysis_ = std::move(*analysis);
+  return file;
+}
+
+std::optional<file_analysis> parse_commonjs_file(const std::filesystem::path& path) {
+  std::error_code ec;
+  return parse_commonjs_file(path, ec);
+}
+
+}  // namespace lexer
@@ -0,0 +1,32 @@
+#ifndef MERVE_FILE_CONTENTS_H
+#define MERVE_FILE_CONTENTS_H
+
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+
+namespace lexer {
+
+// The contents of a file, read by read_file(). Defined in file.cpp.
+struct file_contents {
+  const char* data = nullptr;
+  size_t size = 0;
+  // Whether data is a read-only mapping of the file or a heap copy of it.
+  bool mapped = false;
+};
+
+// Maps a regular file read-only, or reads any other file into a heap buffer;
+// with `map` false, reads every file into a heap buffer. Empty files have null
+// data. On failure, sets `ec` and returns false.
+bool read_file(const std::filesystem::path& path, file_contents& out, std::error_code& ec, bool map = true);
+
+// Flushes what was written to a file to the storage device, so that it
+// survives a crash. On failure, sets `ec` and returns false.
+bool sync_file(const std::filesystem::path& path, std::error_code& ec);
+
+// Unmaps or frees what read_file() returned.
+void release_file(const file_contents& contents) noexcept;
+
+}  // namespace lexer
+
+#endif  // MERVE_FILE_CONTENTS_H
@@ -0,0 +1,156 @@
+// Vectorized scanning kernels, compiled once per implementation. The including
+// file opens the implementation's namespace and target region and defines
+// simd8x64 for its instruction set first. This file deliberately has no
+// include guard. Whatever is left after the last full 64-byte block goes to
+// the scalar kernels.
+
+namespace {
+
+// Bits set in `mask` that are followed by a bit in `next`; `carry` says
+// whether the byte right after the block belongs to `next`.
+inline uint64_t followed_by(uint64_t mask, uint64_t next, bool carry) {
+  return mask & ((next >> 1) | (static_cast<uint64_t>(carry) << 63));
+}
+
+// One bit per line terminator: every '\n', and every '\r' that does not
+// start a CRLF pair. `next` is the byte after the block ('\0' at the end).
+inline uint64_t line_terminators(const simd8x64& block, char next) {
+  uint64_t lf = block.eq('\n');
+  uint64_t cr = block.eq('\r');
+  return lf | (cr & ~followed_by(cr, lf, next == '\n'));
+}
+
+// Bytes that may continue an identifier: ASCII letters, digits, '_', '$'
+// and anything outside ASCII.
+inline uint64_t identifier_bytes(const simd8x64& block) {
+  return block.in_range('a', 'z') | block.in_range('A', 'Z') | block.in_range('0', '9') |
+         block.eq_any('_', '$') | block.high_bits();
+}
+
+const char* find_line_terminator(const char* p, const char* end) {
+  while (end - p >= 64) {
+    simd8x64 block = simd8x64::load(p);
+    uint64_t terminators = block.eq_any('\n', '\r');
+    if (terminators) {
+      return p + std::countr_zero(terminators);
+    }
+    p += 64;
+  }
+  return scalar::find_line_terminator(p, end);
+}
+
+const char* find_block_comment_end(const char* p, const char* end) {
+  while (end - p >= 64) {
+    simd8x64 block = simd8x64::load(p);
+    char next = end - p > 64 ? p[64] : '\0';
+    uint64_t close = followed_by(block.eq('*'), block.eq('/'), next == '/');
+    if (close) {
+      return p + std::countr_zero(close);
+    }
+    p += 64;
+  }
+  return scalar::find_block_comment_end(p, end);
+}
+
+const char* find_quote_or_escape(const char* p, const char* end, char quote) {
+  // Most literals are short specifiers and property names: look at the
+  // first few bytes in scalar code before paying for a full block.
+  const char* prefix_end = end - p > 16 ? p + 16 : end;
+  p = scalar::find_quote_or_escape(p, prefix_end, quote);
+  if (p < prefix_end) {
+    return p;
+  }
+  while (end - p >= 64) {
+    simd8x64 block = simd8x64::load(p);
+    uint64_t special = block.eq_any(quote, '\\', '\n', '\r');
+    if (special) {
+      return p + std::countr_zero(special);
+    }
+    p += 64;
+  }
+  return scalar::find_quote_or_escape(p, end, quote);
+}
+
+// Returns a pointer to the first '`', '\\' or "${" in [p, end), or end.
+const char* find_template_special(const char* p, const char* end) {
+  // Short spans between `${...}` substitutions are common; handle them in
+  // scalar code before loading a full block.
+  for (const char* prefix_end = end - p > 16 ? p + 16 : end; p < prefix_end; p++) {
+    if (scalar::is_template_special(p, end)) {
+      return p;
+    }
+  }
+  while (end - p >= 64) {
+    simd8x64 block = simd8x64::load(p);
+    char next = end - p > 64 ? p[64] : '\0';
+    uint64_t substitution = followed_by(block.eq('$'), block.eq('{'), next == '{');
+    uint64_t special = block.eq_any('`', '\\') | substitution;
+    if (special) {
+      return p + std::countr_zero(special);
+    }
+    p += 64;
+  }
+  for (; p < end; p++) {
+    if (scalar::is_template_special(p, end)) {
+      return p;
+    }
+  }
+  return end;
+}
+
+const char* find_template_end(const char* p, const char* end) {
+  for (;;) {
+    p = find_template_special(p, end);
+    if (p == end || *p != '\\') {
+      return p;
+    }
+    // The escaped character never ends the literal.
+    if (end - p <= 2) {
+      return end;
+    }
+    p += 2;
+  }
+}
+
+uint32_t count_line_terminators(const char* p, const char* end) {
+  uint32_t lines = 0;
+  while (end - p >= 64) {
+    simd8x64 block = simd8x64::load(p);
+    char next = end - p > 64 ? p[64] : '\0';
+    lines += static_cast<uint32_t>(std::popcount(line_terminators(block, next)));
+    p += 64;
+  }
+  return lines + scalar::count_line_terminators(p, end);
+}
+
+uint64_t structural_block(const char* p, const char* end, char prev) {
+  char tail[64];
+  const char* data = p;
+  char next = '\0';
+  if (end - p > 64) {
+    next = p[64];
+  } else if (end - p < 64) {
+    // Pad with NULs, which are neither structural nor part of an identifier.
+    std::memset(tail, 0, sizeof(tail));
+    std::memcpy(tail, p, static_cast<size_t>(end - p));
+    data = tail;
+  }
+  simd8x64 block = simd8x64::load(data);
+  uint64_t structural = block.eq_any('\'', '"', '`', '/', '(', ')', '{', '}');
+  // Every keyword the main loop matches starts with one of these letters and
+  // only counts when it does not continue an identifier. The exception is
+  // require(), which is tried wherever "re" appears.
+  uint64_t keyword_start = block.eq_any('e', 'm', 'O', 'c', 'i', 'r', '_');
+  uint64_t identifier = identifier_bytes(block);
+  uint64_t prev_identifier = scalar::is_identifier_byte(prev);
+  uint64_t after_identifier = (identifier << 1) | prev_identifier;
+  uint64_t require = followed_by(block.eq('r'), block.eq('e'), next == 'e');
+  return structural | (keyword_start & ~after_identifier) | require;
+}
+
+}  // namespace
+
+const kernels kernel_table = {
+    find_line_terminator,  find_block_comment_end,  find_quote_or_escape,
+    find_template_end,     count_line_terminators, structural_block,
+};
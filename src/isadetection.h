@@ -0,0 +1,118 @@
+#ifndef MERVE_ISADETECTION_H
+#define MERVE_ISADETECTION_H
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_AMD64)
+#define MERVE_IS_X86_64 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MERVE_IS_ARM64 1
+#endif
+
+namespace lexer::internal {
+
+// Instruction sets an implementation may require, as a bit set.
+enum instruction_set : uint32_t {
+  DEFAULT = 0,
+  NEON = 1u << 0,
+  SSE42 = 1u << 1,
+  POPCNT = 1u << 2,
+  AVX2 = 1u << 3,
+  BMI1 = 1u << 4,
+  BMI2 = 1u << 5,
+  AVX512F = 1u << 6,
+  AVX512BW = 1u << 7,
+  AVX512VL = 1u << 8,
+};
+
+#if defined(MERVE_IS_X86_64)
+
+namespace cpuid_bit {
+// cpuid(1): ecx
+constexpr uint32_t sse42 = 1u << 20;
+constexpr uint32_t popcnt = 1u << 23;
+constexpr uint32_t osxsave = 1u << 27;
+// cpuid(7, 0): ebx
+constexpr uint32_t bmi1 = 1u << 3;
+constexpr uint32_t avx2 = 1u << 5;
+constexpr uint32_t bmi2 = 1u << 8;
+constexpr uint32_t avx512f = 1u << 16;
+constexpr uint32_t avx512bw = 1u << 30;
+constexpr uint32_t avx512vl = 1u << 31;
+// xgetbv(0): register state the OS saves on context switches
+constexpr uint64_t xcr0_ymm = 0x6;   // XMM and YMM
+constexpr uint64_t xcr0_zmm = 0xe6;  // XMM, YMM, opmask and ZMM
+}  // namespace cpuid_bit
+
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int i = 0; i < 4; i++) regs[i] = static_cast<uint32_t>(info[i]);
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+inline uint64_t xgetbv() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+inline uint32_t detect_supported_architectures() {
+  uint32_t regs[4];
+  uint32_t result = DEFAULT;
+
+  cpuid(0, 0, regs);
+  uint32_t max_leaf = regs[0];
+
+  cpuid(1, 0, regs);
+  uint32_t ecx = regs[2];
+  if (ecx & cpuid_bit::sse42) result |= SSE42;
+  if (ecx & cpuid_bit::popcnt) result |= POPCNT;
+
+  // AVX state is only usable when the OS saves it.
+  uint64_t xcr0 = (ecx & cpuid_bit::osxsave) ? xgetbv() : 0;
+  bool ymm = (xcr0 & cpuid_bit::xcr0_ymm) == cpuid_bit::xcr0_ymm;
+  bool zmm = (xcr0 & cpuid_bit::xcr0_zmm) == cpuid_bit::xcr0_zmm;
+
+  if (max_leaf >= 7) {
+    cpuid(7, 0, regs);
+    uint32_t ebx = regs[1];
+    if (ebx & cpuid_bit::bmi1) result |= BMI1;
+    if (ebx & cpuid_bit::bmi2) result |= BMI2;
+    if (ymm && (ebx & cpuid_bit::avx2)) result |= AVX2;
+    if (zmm && (ebx & cpuid_bit::avx512f)) result |= AVX512F;
+    if (zmm && (ebx & cpuid_bit::avx512bw)) result |= AVX512BW;
+    if (zmm && (ebx & cpuid_bit::avx512vl)) result |= AVX512VL;
+  }
+  return result;
+}
+
+#elif defined(MERVE_IS_ARM64)
+
+inline uint32_t detect_supported_architectures() {
+  return NEON;
+}
+
+#else
+
+inline uint32_t detect_supported_architectures() {
+  return DEFAULT;
+}
+
+#endif
+
+}  // namespace lexer::internal
+
+#endif  // MERVE_ISADETECTION_H
@@ -0,0 +1,18 @@
+#ifndef MERVE_LAST_ERROR_H
+#define MERVE_LAST_ERROR_H
+
+#include "merve/parser.h"
+
+#include <optional>
+
+namespace lexer {
+
+// The thread-local state behind get_last_error() and
+// get_last_error_location(), defined in parser.cpp. Set by every function
+// documented to update get_last_error().
+extern thread_local std::optional<lexer_error> last_error;
+extern thread_local std::optional<error_location> last_error_location;
+
+}  // namespace lexer
+
+#endif  // MERVE_LAST_ERROR_H
@@ -1,12 +1,43 @@
 #include "merve.h"
 #include "merve_c.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <new>
 
 struct merve_analysis_impl {
-  std::optional<lexer::lexer_analysis> result{};
+  // Points into `owned` for merve_parse_commonjs(),
+  // merve_parse_commonjs_validated(), merve_parse_commonjs_latin1() and
+  // merve_parse_commonjs_utf16() results, into `file` for
+  // merve_parse_commonjs_file() results, into `shared` for
+  // merve_parse_commonjs_shared() results and into the parser for
+  // merve_parser_parse() results. Null if parsing failed.
+  const lexer::lexer_analysis* result = nullptr;
+  std::optional<lexer::lexer_analysis> owned{};
+  // Keeps the file contents of merve_parse_commonjs_file() results mapped.
+  std::optional<lexer::file_analysis> file{};
+  // Owns the source of merve_parse_commonjs_shared() results.
+  std::shared_ptr<const lexer::lexer_analysis> shared{};
+  // MERVE_ERROR_* constant if parsing failed, -1 otherwise.
+  int error = -1;
+  // Where parsing failed; zero otherwise.
+  size_t error_offset = 0;
+  uint32_t error_line = 0;
+  // Set for the handle embedded in a merve_parser_impl; merve_free() leaves
+  // it alone.
+  bool borrowed = false;
 };
 
+struct merve_parser_impl {
+  lexer::parser parser{};
+  merve_analysis_impl analysis{};
+};
+
+static std::string_view merve_input(const char* input, size_t length) {
+  return input != nullptr ? std::string_view(input, length) : std::string_view("", 0);
+}
+
 static merve_string merve_string_create(const char* data, size_t length) {
   merve_string out{};
   out.data = data;
@@ -14,47 +45,228 @@ static merve_string merve_string_create(const char* data, size_t length) {
   return out;
 }
 
+static size_t merve_copy_entries(
+    const std::vector<lexer::export_entry>& entries, size_t start,
+    merve_string* names, uint32_t* lines, size_t capacity) {
+  if (start >= entries.size()) return 0;
+  size_t count = std::min(capacity, entries.size() - start);
+  for (size_t i = 0; i < count; i++) {
+    const lexer::export_entry& entry = entries[start + i];
+    if (names) {
+      std::string_view sv = lexer::get_string_view(entry);
+      names[i] = merve_string_create(sv.data(), sv.size());
+    }
+    if (lines) lines[i] = entry.line;
+  }
+  return count;
+}
+
+// Copies the outcome of the last parse on this thread into `impl`.
+static void merve_record_error(merve_analysis_impl* impl) {
+  impl->error = merve_get_last_error();
+  const std::optional<lexer::error_location>& location = lexer::get_last_error_location();
+  impl->error_offset = location ? location->offset : 0;
+  impl->error_line = location ? location->line : 0;
+}
+
 extern "C" {
 
 merve_analysis merve_parse_commonjs(const char* input, size_t length) {
   merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
   if (!impl) return nullptr;
-  if (input != nullptr) {
-    impl->result = lexer::parse_commonjs(std::string_view(input, length));
-  } else {
-    impl->result = lexer::parse_commonjs(std::string_view("", 0));
+  impl->owned = lexer::parse_commonjs(merve_input(input, length));
+  if (impl->owned.has_value()) {
+    impl->result = &impl->owned.value();
   }
+  merve_record_error(impl);
+  return static_cast<merve_analysis>(impl);
+}
+
+merve_analysis merve_parse_commonjs_validated(const char* input, size_t length) {
+  merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
+  if (!impl) return nullptr;
+  impl->owned = lexer::parse_commonjs_validated(merve_input(input, length));
+  if (impl->owned.has_value()) {
+    impl->result = &impl->owned.value();
+  }
+  merve_record_error(impl);
+  return static_cast<merve_analysis>(impl);
+}
+
+merve_analysis merve_parse_commonjs_latin1(const char* input, size_t length) {
+  merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
+  if (!impl) return nullptr;
+  impl->owned = lexer::parse_commonjs_latin1(merve_input(input, length));
+  if (impl->owned.has_value()) {
+    impl->result = &impl->owned.value();
+  }
+  merve_record_error(impl);
+  return static_cast<merve_analysis>(impl);
+}
+
+merve_analysis merve_parse_commonjs_utf16(const uint16_t* input, size_t length) {
+  merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
+  if (!impl) return nullptr;
+  impl->owned = lexer::parse_commonjs(
+      input != nullptr ? std::u16string_view(reinterpret_cast<const char16_t*>(input), length)
+                       : std::u16string_view(u"", 0));
+  if (impl->owned.has_value()) {
+    impl->result = &impl->owned.value();
+  }
+  merve_record_error(impl);
+  return static_cast<merve_analysis>(impl);
+}
+
+merve_analysis merve_parse_commonjs_file(const char* path) {
+  if (!path) return nullptr;
+  std::error_code ec;
+  std::optional<lexer::file_analysis> file = lexer::parse_commonjs_file(
+      std::u8string_view(reinterpret_cast<const char8_t*>(path)), ec);
+  if (ec) return nullptr;
+  merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
+  if (!impl) return nullptr;
+  impl->file = std::move(file);
+  if (impl->file.has_value()) {
+    impl->result = &impl->file->analysis();
+  }
+  merve_record_error(impl);
+  return static_cast<merve_analysis>(impl);
+}
+
+merve_analysis merve_parse_commonjs_shared(const char* input, size_t length,
+                                           merve_release_callback release,
+                                           void* context) {
+  // Calls `release` once the last reference to the source is gone. A NULL
+  // input is lexed as "", like merve_parse_commonjs() does.
+  std::shared_ptr<const char[]> source(
+      input != nullptr ? input : "", [release, context](const char*) {
+        if (release) release(context);
+      });
+  merve_analysis_impl* impl = new (std::nothrow) merve_analysis_impl();
+  if (!impl) return nullptr;
+  impl->shared = lexer::parse_commonjs_shared(std::move(source),
+                                              input != nullptr ? length : 0);
+  impl->result = impl->shared.get();
+  merve_record_error(impl);
   return static_cast<merve_analysis>(impl);
 }
 
+bool merve_parse_commonjs_into(const char* input, size_t length,
+                               merve_export* out, size_t capacity,
+                               char* string_buf, size_t string_capacity,
+                               merve_result_info* info) {
+  // Keeps its vectors and stacks from one call to the next.
+  static thread_local lexer::parser parser;
+  const lexer::lexer_analysis* result =
+      parser.parse(merve_input(input, length));
+
+  merve_result_info summary{};
+  summary.error = merve_get_last_error();
+  if (const auto& location = lexer::get_last_error_location()) {
+    summary.error_offset = location->offset;
+    summary.error_line = location->line;
+  }
+  if (result) {
+    summary.exports_count = result->exports.size();
+    summary.reexports_count = result->re_exports.size();
+    for (const auto* entries : {&result->exports, &result->re_exports}) {
+      for (const auto& entry : *entries) {
+        if (const auto* unescaped = std::get_if<std::string>(&entry.name)) {
+          summary.string_length += unescaped->size();
+        }
+      }
+    }
+  }
+  if (info) *info = summary;
+  if (!result) return false;
+  if (summary.exports_count + summary.reexports_count > capacity ||
+      summary.string_length > string_capacity)
+    return false;
+
+  size_t string_offset = 0;
+  for (const auto* entries : {&result->exports, &result->re_exports}) {
+    for (const auto& entry : *entries) {
+      std::string_view sv = lexer::get_string_view(entry);
+      if (std::holds_alternative<std::string>(entry.name)) {
+        // May be empty, and memcpy does not accept a NULL string_buf.
+        if (!sv.empty()) std::memcpy(string_buf + string_offset, sv.data(), sv.size());
+        sv = std::string_view(string_buf + string_offset, sv.size());
+        string_offset += sv.size();
+      }
+      out->name = merve_string_create(sv.data(), sv.size());
+      out->line = entry.line;
+      out++;
+    }
+  }
+  return true;
+}
+
+merve_parser merve_parser_create(void) {
+  merve_parser_impl* impl = new (std::nothrow) merve_parser_impl();
+  if (!impl) return nullptr;
+  impl->analysis.borrowed = true;
+  return static_cast<merve_parser>(impl);
+}
+
+merve_analysis merve_parser_parse(merve_parser parser, const char* input,
+                                  size_t length) {
+  if (!parser) return nullptr;
+  merve_parser_impl* impl = static_cast<merve_parser_impl*>(parser);
+  impl->analysis.result = impl->parser.parse(merve_input(input, length));
+  merve_record_error(&impl->analysis);
+  return static_cast<merve_analysis>(&impl->analysis);
+}
+
+void merve_parser_free(merve_parser parser) {
+  if (!parser) return;
+  delete static_cast<merve_parser_impl*>(parser);
+}
+
 bool merve_is_valid(merve_analysis result) {
   if (!result) return false;
-  return static_cast<merve_analysis_impl*>(result)->result.has_value();
+  return static_cast<merve_analysis_impl*>(result)->result != nullptr;
+}
+
+int merve_get_error(merve_analysis result) {
+  if (!result) return -1;
+  return static_cast<merve_analysis_impl*>(result)->error;
+}
+
+size_t merve_get_error_offset(merve_analysis result) {
+  if (!result) return 0;
+  return static_cast<merve_analysis_impl*>(result)->error_offset;
+}
+
+uint32_t merve_get_error_line(merve_analysis result) {
+  if (!result) return 0;
+  return static_cast<merve_analysis_impl*>(result)->error_line;
 }
 
 void merve_free(merve_analysis result) {
   if (!result) return;
-  delete static_cast<merve_analysis_impl*>(result);
+  merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
+  if (impl->borrowed) return;
+  delete impl;
 }
 
 size_t merve_get_exports_count(merve_analysis result) {
   if (!result) return 0;
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return 0;
+  if (!impl->result) return 0;
   return impl->result->exports.size();
 }
 
 size_t merve_get_reexports_count(merve_analysis result) {
   if (!result) return 0;
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return 0;
+  if (!impl->result) return 0;
   return impl->result->re_exports.size();
 }
 
 merve_string merve_get_export_name(merve_analysis result, size_t index) {
   if (!result) return merve_string_create(nullptr, 0);
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return merve_string_create(nullptr, 0);
+  if (!impl->result) return merve_string_create(nullptr, 0);
   if (index >= impl->result->exports.size())
     return merve_string_create(nullptr, 0);
   std::string_view sv =
@@ -65,7 +277,7 @@ merve_string merve_get_export_name(merve_analysis result, size_t index) {
 uint32_t merve_get_export_line(merve_analysis result, size_t index) {
   if (!result) return 0;
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return 0;
+  if (!impl->result) return 0;
   if (index >= impl->result->exports.size()) return 0;
   return impl->result->exports[index].line;
 }
@@ -73,7 +285,7 @@ uint32_t merve_get_export_line(merve_analysis result, size_t index) {
 merve_string merve_get_reexport_name(merve_analysis result, size_t index) {
   if (!result) return merve_string_create(nullptr, 0);
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return merve_string_create(nullptr, 0);
+  if (!impl->result) return merve_string_create(nullptr, 0);
   if (index >= impl->result->re_exports.size())
     return merve_string_create(nullptr, 0);
   std::string_view sv =
@@ -84,11 +296,31 @@ merve_string merve_get_reexport_name(merve_analysis result, size_t index) {
 uint32_t merve_get_reexport_line(merve_analysis result, size_t index) {
   if (!result) return 0;
   merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
-  if (!impl->result.has_value()) return 0;
+  if (!impl->result) return 0;
   if (index >= impl->result->re_exports.size()) return 0;
   return impl->result->re_exports[index].line;
 }
 
+size_t merve_get_exports(merve_analysis result, size_t start,
+                         merve_string* names, uint32_t* lines,
+                         size_t capacity) {
+  if (!result) return 0;
+  merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
+  if (!impl->result) return 0;
+  return merve_copy_entries(impl->result->exports, start, names, lines,
+                            capacity);
+}
+
+size_t merve_get_reexports(merve_analysis result, size_t start,
+                           merve_string* names, uint32_t* lines,
+                           size_t capacity) {
+  if (!result) return 0;
+  merve_analysis_impl* impl = static_cast<merve_analysis_impl*>(result);
+  if (!impl->result) return 0;
+  return merve_copy_entries(impl->result->re_exports, start, names, lines,
+                            capacity);
+}
+
 int merve_get_last_error(void) {
   const std::optional<lexer::lexer_error>& err = lexer::get_last_error();
   if (!err.has_value()) return -1;
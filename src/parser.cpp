@@ -1,12 +1,27 @@
 #include "merve/parser.h"
+#include "last_error.h"
+#include "scan.h"
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <limits>
+#include <type_traits>
 
 #ifdef MERVE_USE_SIMDUTF
 #include <simdutf.h>
 #endif
 
+// Keeps cold or bulky helpers out of CJSLexer::parse so its main loop stays
+// small enough to be optimized well.
+#if defined(_MSC_VER)
+#define MERVE_NOINLINE __declspec(noinline)
+#else
+#define MERVE_NOINLINE __attribute__((noinline))
+#endif
+
 namespace lexer {
 
 // ============================================================================
@@ -113,6 +128,32 @@ static constexpr std::array<bool, 256> kBrOrWsTable = []() consteval {
   return table;
 }();
 
+// Latin-1 variants of the tables above. In Latin-1, bytes >= 0x80 are whole
+// characters: only the letters among them continue identifiers, and 0xA0 is
+// a no-break space.
+static constexpr std::array<bool, 256> kLatin1IdentifierStartTable = []() consteval {
+  std::array<bool, 256> table = kIdentifierStartTable;
+  for (int i = 0x80; i < 256; ++i) table[i] = false;
+  table[0xAA] = true;  // ª
+  table[0xB5] = true;  // µ
+  table[0xBA] = true;  // º
+  for (int i = 0xC0; i < 256; ++i) table[i] = i != 0xD7 && i != 0xF7;  // À-ÿ except × and ÷
+  return table;
+}();
+
+static constexpr std::array<bool, 256> kLatin1IdentifierCharTable = []() consteval {
+  std::array<bool, 256> table = kLatin1IdentifierStartTable;
+  for (int i = '0'; i <= '9'; ++i) table[i] = true;
+  table[0xB7] = true;  // ·
+  return table;
+}();
+
+static constexpr std::array<bool, 256> kLatin1BrOrWsTable = []() consteval {
+  std::array<bool, 256> table = kBrOrWsTable;
+  table[0xA0] = true;
+  return table;
+}();
+
 // ============================================================================
 // Inline functions using lookup tables
 // ============================================================================
@@ -124,7 +165,8 @@ inline int hexDigit(unsigned char c) {
 }
 
 // Encode a Unicode code point as UTF-8 into the output string
-inline void encodeUtf8(std::string& out, uint32_t codepoint) {
+template <typename String>
+inline void encodeUtf8(String& out, uint32_t codepoint) {
 #ifdef MERVE_USE_SIMDUTF
   // Use simdutf for optimized UTF-32 to UTF-8 conversion
   char buf[4];
@@ -150,10 +192,12 @@ inline void encodeUtf8(std::string& out, uint32_t codepoint) {
 #endif
 }
 
-// Unescape JavaScript string escape sequences
-// Returns empty optional on invalid escape sequences (like lone surrogates)
-std::optional<std::string> unescapeJsString(std::string_view str) {
-  std::string result;
+// Unescape JavaScript string escape sequences into a String allocated with
+// `allocator`. Returns empty optional on invalid escape sequences (like lone
+// surrogates)
+template <typename String = std::string>
+std::optional<String> unescapeJsString(std::string_view str, const typename String::allocator_type& allocator = {}) {
+  String result(allocator);
   result.reserve(str.size());
 
   for (size_t i = 0; i < str.size(); ++i) {
@@ -293,10 +337,167 @@ std::optional<std::string> unescapeJsString(std::string_view str) {
   return result;
 }
 
+// Returns the start of the first invalid UTF-8 sequence in [p, end), or end.
+// Overlong encodings, surrogates and code points above U+10FFFF are invalid.
+const char* findInvalidUtf8(const char* p, const char* end) {
+#ifdef MERVE_USE_SIMDUTF
+  simdutf::result result = simdutf::validate_utf8_with_errors(p, static_cast<size_t>(end - p));
+  return result.error == simdutf::error_code::SUCCESS ? end : p + result.count;
+#else
+  while (p < end) {
+    // Most source is ASCII: check 32 bytes at a time.
+    if (end - p >= 32) {
+      uint64_t words[4];
+      std::memcpy(words, p, sizeof(words));
+      if (((words[0] | words[1] | words[2] | words[3]) & 0x8080808080808080) == 0) {
+        p += 32;
+        continue;
+      }
+    }
+    auto byte = [p](size_t i) { return static_cast<unsigned char>(p[i]); };
+    unsigned char lead = byte(0);
+    if (lead < 0x80) {
+      p++;
+      continue;
+    }
+    // The valid range of the second byte depends on the lead byte.
+    size_t length;
+    unsigned char min = 0x80;
+    unsigned char max = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      length = 3;
+      if (lead == 0xE0) min = 0xA0;       // overlong
+      else if (lead == 0xED) max = 0x9F;  // surrogates
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      length = 4;
+      if (lead == 0xF0) min = 0x90;       // overlong
+      else if (lead == 0xF4) max = 0x8F;  // above U+10FFFF
+    } else {
+      return p;
+    }
+    if (static_cast<size_t>(end - p) < length || byte(1) < min || byte(1) > max) {
+      return p;
+    }
+    for (size_t i = 2; i < length; i++) {
+      if ((byte(i) & 0xC0) != 0x80) {
+        return p;
+      }
+    }
+    p += length;
+  }
+  return end;
+#endif
+}
+
+// ============================================================================
+// Input encodings
+// ============================================================================
+
+// Each encoding names its code unit type, the tables that classify its code
+// units and how to convert export names to the UTF-8 the results hold. Only
+// ASCII code units are significant to the lexer otherwise, so it scans any of
+// them the same way.
+
+struct utf8_input {
+  using code_unit = char;
+  static constexpr const std::array<bool, 256>& identifier_start_table = kIdentifierStartTable;
+  static constexpr const std::array<bool, 256>& identifier_char_table = kIdentifierCharTable;
+  static constexpr const std::array<bool, 256>& br_or_ws_table = kBrOrWsTable;
+};
+
+// UTF-8 that is rejected with INVALID_UTF8 unless it is valid.
+struct validated_utf8_input : utf8_input {};
+
+// One byte per character, as in V8's one-byte strings.
+struct latin1_input {
+  using code_unit = char;
+  static constexpr const std::array<bool, 256>& identifier_start_table = kLatin1IdentifierStartTable;
+  static constexpr const std::array<bool, 256>& identifier_char_table = kLatin1IdentifierCharTable;
+  static constexpr const std::array<bool, 256>& br_or_ws_table = kLatin1BrOrWsTable;
+
+  // Whether `name` is ASCII, so that it reads the same as UTF-8.
+  static bool is_ascii(std::string_view name) {
+#ifdef MERVE_USE_SIMDUTF
+    return simdutf::validate_ascii(name.data(), name.size());
+#else
+    for (char c : name) {
+      if (static_cast<unsigned char>(c) >= 0x80) return false;
+    }
+    return true;
+#endif
+  }
+
+  static std::optional<std::string> to_utf8(std::string_view name) {
+    std::string out;
+#ifdef MERVE_USE_SIMDUTF
+    out.resize(simdutf::utf8_length_from_latin1(name.data(), name.size()));
+    simdutf::convert_latin1_to_utf8(name.data(), name.size(), out.data());
+#else
+    out.reserve(name.size() * 2);
+    for (char c : name) {
+      encodeUtf8(out, static_cast<unsigned char>(c));
+    }
+#endif
+    return out;
+  }
+};
+
+// Code units below 0x100 are Latin-1 characters, so they classify as in
+// latin1_input. Those beyond the tables are taken for identifier characters,
+// like non-ASCII UTF-8, and classify like wide_code_unit (À).
+struct utf16_input {
+  using code_unit = char16_t;
+  static constexpr const std::array<bool, 256>& identifier_start_table = kLatin1IdentifierStartTable;
+  static constexpr const std::array<bool, 256>& identifier_char_table = kLatin1IdentifierCharTable;
+  static constexpr const std::array<bool, 256>& br_or_ws_table = kLatin1BrOrWsTable;
+  static constexpr uint8_t wide_code_unit = 0xC0;
+
+  // Returns nullopt if the name contains a lone surrogate.
+  static std::optional<std::string> to_utf8(std::u16string_view name) {
+    std::string out;
+#ifdef MERVE_USE_SIMDUTF
+    if (!simdutf::validate_utf16(name.data(), name.size())) {
+      return std::nullopt;
+    }
+    out.resize(simdutf::utf8_length_from_utf16(name.data(), name.size()));
+    simdutf::convert_valid_utf16_to_utf8(name.data(), name.size(), out.data());
+#else
+    out.reserve(name.size());
+    for (size_t i = 0; i < name.size(); i++) {
+      uint32_t cp = name[i];
+      if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < name.size() && name[i + 1] >= 0xDC00 && name[i + 1] <= 0xDFFF) {
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (name[++i] - 0xDC00u);
+      } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+        return std::nullopt;
+      }
+      encodeUtf8(out, cp);
+    }
+#endif
+    return out;
+  }
+};
+
 // Stack depth limits
 constexpr size_t STACK_DEPTH = 2048;
 constexpr size_t MAX_STAR_EXPORTS = 256;
 
+// Validated inputs are checked this many bytes ahead of the lexer, so each
+// chunk is still in cache when the lexer reaches it.
+constexpr size_t UTF8_VALIDATION_CHUNK_SIZE = 16 * 1024;
+
+// Exports are de-duplicated with a linear scan until a module has this many,
+// then with a hash set.
+constexpr size_t EXPORT_INDEX_MIN_SIZE = 32;
+
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+// Inputs at least this large are lexed in two stages: vectorized stage 1
+// marks the bytes of each 64-byte block the main loop has to look at, and
+// the main loop jumps between them.
+constexpr size_t STRUCTURAL_INDEX_MIN_SIZE = 1024;
+#endif
+
 // RequireType enum for parsing require statements
 enum class RequireType {
   Import,
@@ -304,102 +505,167 @@ enum class RequireType {
   ExportStar
 };
 
-// StarExportBinding structure for tracking star export bindings
-struct StarExportBinding {
-  std::string_view specifier;
-  std::string_view id;
+// What opened each level of the open token stack
+enum class OpenToken : uint8_t {
+  Paren,
+  Brace,
+  ClassBrace,
+  Substitution,  // "${" in a template literal
 };
 
-// Thread-local state for error tracking (safe for concurrent parse calls).
+// Thread-local state for error tracking (safe for concurrent parse calls),
+// see last_error.h.
 thread_local std::optional<lexer_error> last_error;
+thread_local std::optional<error_location> last_error_location;
 
-// Lexer state class
+// Lexer state class, for one of the input encodings above. Exports are
+// appended to the vectors of an Analysis: a lexer_analysis, or a
+// pmr::lexer_analysis whose allocator unescaped names are allocated with.
+template <typename Input, typename Analysis = lexer_analysis>
 class CJSLexer {
 private:
-  const char* source;
-  const char* pos;
-  const char* end;
-  const char* lastTokenPos;
+  using Char = typename Input::code_unit;
+  using entry_list = decltype(Analysis::exports);
+  using entry_type = typename entry_list::value_type;
+  using name_string = std::variant_alternative_t<0, decltype(entry_type::name)>;
+  using view = std::basic_string_view<Char>;
+  static constexpr bool kUtf8 = std::is_base_of_v<utf8_input, Input>;
+  static constexpr bool kValidateUtf8 = std::is_same_v<Input, validated_utf8_input>;
+
+  struct StarExportBinding {
+    view specifier;
+    view id;
+  };
+
+  const Char* source;
+  const Char* pos;
+  const Char* end;
+  const Char* lastTokenPos;
 
   uint16_t templateStackDepth;
   uint16_t openTokenDepth;
   uint16_t templateDepth;
 
-  uint32_t line;
-
   bool lastSlashWasDivision;
   bool nextBraceIsClass;
 
+  // Every slot is written when its token is pushed, so a lexer reused by
+  // lexer::parser never reads a slot left over from an earlier parse.
   std::array<uint16_t, STACK_DEPTH> templateStack_;
-  std::array<const char*, STACK_DEPTH> openTokenPosStack_;
-  std::array<bool, STACK_DEPTH> openClassPosStack;
+  std::array<const Char*, STACK_DEPTH> openTokenPosStack_;
+  std::array<OpenToken, STACK_DEPTH> openTokenKind_;
   std::array<StarExportBinding, MAX_STAR_EXPORTS> starExportStack_;
   StarExportBinding* starExportStack;
   const StarExportBinding* STAR_EXPORT_STACK_END;
 
-  std::vector<export_entry>& exports;
-  std::vector<export_entry>& re_exports;
+  // Scanning kernels of the implementation active when parse() started.
+  const scan::basic_kernels<Char>* kernels;
+
+  std::optional<lexer_error> error_;
+  // Where error_ was detected.
+  const Char* errorPos_;
+  // End of the source validated so far, for validated_utf8_input.
+  const Char* validatedEnd_;
+
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+  // Stage 1 state, see scan::structural_block: the bytes to stop at in the
+  // structuralBlockSize_ bytes starting at source + structuralBlock_. The
+  // main loop only consults it once pos reaches structuralCheck.
+  const Char* structuralCheck;
+  size_t structuralBlock_;
+  size_t structuralBlockSize_;
+  uint64_t structuralMask_;
+#endif
+
+  entry_list& exports;
+  entry_list& re_exports;
+
+  // Open-addressing hash set over the names in `exports`, with linear
+  // probing: each slot holds an index into exports plus one, or 0 when
+  // empty. Stays empty for modules with few exports.
+  std::vector<uint32_t> exportIndex_;
 
-  // Increments `line` when consuming a line terminator.
-  // - Counts '\n' as a newline.
-  // - Counts '\r' as a newline only when it is not part of a CRLF sequence.
-  //   (i.e., the next character is not '\n' or we're at end-of-input.)
-  void countNewline(char ch) {
-    line += (ch == '\n') || (ch == '\r' && (pos + 1 >= end || *(pos + 1) != '\n'));
+  // Export entries store the byte offset of the lexer at the time they were
+  // found in their `line` field until resolveLines() turns it into a line
+  // number, so the main loop never has to count line terminators.
+  uint32_t offset() const {
+    return static_cast<uint32_t>(pos - source);
+  }
+
+  // The lookup table entry for a code unit. The tables have one entry per
+  // byte; code units beyond them classify like Input::wide_code_unit.
+  static constexpr uint8_t tableIndex(Char c) {
+    if constexpr (sizeof(Char) == 1) {
+      return static_cast<uint8_t>(c);
+    } else {
+      return c < 0x100 ? static_cast<uint8_t>(c) : Input::wide_code_unit;
+    }
   }
 
   // Character classification helpers using lookup tables
-  static bool isBr(char c) {
-    return c == '\r' || c == '\n';
+  static bool isBrOrWs(Char c) {
+    return Input::br_or_ws_table[tableIndex(c)];
   }
 
-  static bool isBrOrWs(unsigned char c) {
-    return kBrOrWsTable[c];
+  static bool isBrOrWsOrPunctuatorNotDot(Char c) {
+    return Input::br_or_ws_table[tableIndex(c)] || (kPunctuatorTable[tableIndex(c)] && c != '.');
   }
 
-  static bool isBrOrWsOrPunctuatorNotDot(unsigned char c) {
-    return kBrOrWsTable[c] || (kPunctuatorTable[c] && c != '.');
+  static bool isPunctuator(Char ch) {
+    return kPunctuatorTable[tableIndex(ch)];
   }
 
-  static bool isPunctuator(unsigned char ch) {
-    return kPunctuatorTable[ch];
+  static bool isExpressionPunctuator(Char ch) {
+    return kExpressionPunctuatorTable[tableIndex(ch)];
   }
 
-  static bool isExpressionPunctuator(unsigned char ch) {
-    return kExpressionPunctuatorTable[ch];
+  // Whether the ASCII string `expected` appears at p.
+  template <size_t N>
+  static constexpr bool matchesAt(const Char* p, const Char* end_pos, const char (&expected)[N]) {
+    if (end_pos - p < static_cast<ptrdiff_t>(N - 1)) return false;
+    for (size_t i = 0; i < N - 1; ++i) {
+      if (p[i] != static_cast<Char>(expected[i])) return false;
+    }
+    return true;
   }
 
-  // String comparison helpers using string_view for cleaner, more maintainable code
-  static constexpr bool matchesAt(const char* p, const char* end_pos, std::string_view expected) {
-    size_t available = static_cast<size_t>(end_pos - p);
-    if (available < expected.size()) return false;
+  // Whether the identifier `expected`, taken from the source, appears at p.
+  static constexpr bool matchesAt(const Char* p, const Char* end_pos, view expected) {
+    if (end_pos - p < static_cast<ptrdiff_t>(expected.size())) return false;
     for (size_t i = 0; i < expected.size(); ++i) {
       if (p[i] != expected[i]) return false;
     }
     return true;
   }
 
+  // The code unit at p, or '\0' at or past the end. The source need not be
+  // followed by a NUL: a mapped file may end right at a page boundary.
+  Char charAt(const Char* p) const {
+    return p < end ? *p : Char('\0');
+  }
+
   // Character type detection using lookup tables
-  static bool isIdentifierStart(uint8_t ch) {
-    return kIdentifierStartTable[ch];
+  static bool isIdentifierStart(Char ch) {
+    return Input::identifier_start_table[tableIndex(ch)];
   }
 
-  static bool isIdentifierChar(uint8_t ch) {
-    return kIdentifierCharTable[ch];
+  static bool isIdentifierChar(Char ch) {
+    return Input::identifier_char_table[tableIndex(ch)];
   }
 
-  constexpr bool keywordStart(const char* p) const {
+  constexpr bool keywordStart(const Char* p) const {
     return p == source || isBrOrWsOrPunctuatorNotDot(*(p - 1));
   }
 
-  constexpr bool readPrecedingKeyword(const char* p, std::string_view keyword) const {
-    if (p - static_cast<ptrdiff_t>(keyword.size()) + 1 < source) return false;
-    const char* start = p - keyword.size() + 1;
+  template <size_t N>
+  constexpr bool readPrecedingKeyword(const Char* p, const char (&keyword)[N]) const {
+    if (p - static_cast<ptrdiff_t>(N - 1) + 1 < source) return false;
+    const Char* start = p - (N - 1) + 1;
     return matchesAt(start, end, keyword) && (start == source || isBrOrWsOrPunctuatorNotDot(*(start - 1)));
   }
 
   // Keyword detection
-  constexpr bool isExpressionKeyword(const char* p) const {
+  constexpr bool isExpressionKeyword(const Char* p) const {
     switch (*p) {
       case 'd':
         switch (*(p - 1)) {
@@ -459,13 +725,13 @@ private:
     return false;
   }
 
-  constexpr bool isParenKeyword(const char* curPos) const {
+  constexpr bool isParenKeyword(const Char* curPos) const {
     return readPrecedingKeyword(curPos, "while") ||
            readPrecedingKeyword(curPos, "for") ||
            readPrecedingKeyword(curPos, "if");
   }
 
-  constexpr bool isExpressionTerminator(const char* curPos) const {
+  constexpr bool isExpressionTerminator(const Char* curPos) const {
     switch (*curPos) {
       case '>':
         return *(curPos - 1) == '=';
@@ -484,19 +750,20 @@ private:
 
   // Parsing utilities
   void syntaxError(lexer_error code) {
-    if (!last_error) {
-      last_error = code;
+    if (!error_) {
+      error_ = code;
+      errorPos_ = std::clamp(pos, source, end);
     }
     pos = end + 1;
   }
 
-  char commentWhitespace() {
-    char ch;
+  MERVE_NOINLINE Char commentWhitespace() {
+    Char ch;
     do {
       if (pos >= end) return '\0';
       ch = *pos;
       if (ch == '/') {
-        char next_ch = pos + 1 < end ? *(pos + 1) : '\0';
+        Char next_ch = pos + 1 < end ? *(pos + 1) : '\0';
         if (next_ch == '/')
           lineComment();
         else if (next_ch == '*')
@@ -505,59 +772,47 @@ private:
           return ch;
       } else if (!isBrOrWs(ch)) {
         return ch;
-      } else {
-        countNewline(ch);
       }
     } while (pos++ < end);
     return ch;
   }
 
   void lineComment() {
-    while (pos++ < end) {
-      char ch = *pos;
-      if (ch == '\n' || ch == '\r') {
-        countNewline(ch);
-        return;
-      }
+    // Source map comments can be megabytes long, so jump straight to the
+    // next line terminator instead of walking the comment byte by byte.
+    pos = kernels->find_line_terminator(pos + 1, end);
+    if (pos >= end) {
+      pos = end + 1;
     }
   }
 
   void blockComment() {
-    pos++;
-    while (pos++ < end) {
-      char ch = *pos;
-      if (ch == '*' && *(pos + 1) == '/') {
-        pos++;
-        return;
-      }
-      countNewline(ch);
-    }
+    // Skip "/*", then jump straight to the closing "*/".
+    const Char* close = kernels->find_block_comment_end(pos + 2, end);
+    pos = close < end ? close + 1 : end + 1;
   }
 
-  void stringLiteral(char quote) {
-    while (pos++ < end) {
-      char ch = *pos;
+  MERVE_NOINLINE void stringLiteral(Char quote) {
+    // Only the closing quote, escapes and line breaks matter inside a string
+    // literal, so skip everything else in bulk and handle those in scalar code.
+    pos = kernels->find_quote_or_escape(pos + 1, end, quote);
+    while (pos < end) {
+      Char ch = *pos;
       if (ch == quote)
         return;
-      if (ch == '\\') {
-        if (pos + 1 >= end) break;
-        ch = *++pos;
-        if (ch == '\r') {
-          ++line;
-          if (*(pos + 1) == '\n')
-            pos++;
-        } else if (ch == '\n') {
-          ++line;
-        }
-      } else if (isBr(ch))
+      if (ch != '\\' || pos + 1 >= end)
         break;
+      // An escaped CRLF is a single line continuation.
+      if (*++pos == '\r' && pos + 1 < end && *(pos + 1) == '\n')
+        pos++;
+      pos = kernels->find_quote_or_escape(pos + 1, end, quote);
     }
     syntaxError(lexer_error::UNTERMINATED_STRING_LITERAL);
   }
 
   void regularExpression() {
-    while (pos++ < end) {
-      char ch = *pos;
+    while (++pos < end) {
+      Char ch = *pos;
       if (ch == '/')
         return;
       if (ch == '[') {
@@ -572,8 +827,8 @@ private:
   }
 
   void regexCharacterClass() {
-    while (pos++ < end) {
-      char ch = *pos;
+    while (++pos < end) {
+      Char ch = *pos;
       if (ch == ']')
         return;
       if (ch == '\\') {
@@ -585,38 +840,45 @@ private:
     syntaxError(lexer_error::UNTERMINATED_REGEX_CHARACTER_CLASS);
   }
 
+  // Opens a paren, brace or substitution. The '/' check reads the slot above
+  // the top of the stack, which a ')' or '}' consumed without popping (e.g.
+  // by tryParseRequire) leaves unwritten, so clear it rather than leave it to
+  // a deeper nesting of the previous source a reused parser lexed.
+  void pushOpenToken(OpenToken kind, const Char* tokenPos) {
+    openTokenKind_[openTokenDepth] = kind;
+    openTokenPosStack_[openTokenDepth++] = tokenPos;
+    if (openTokenDepth < STACK_DEPTH) {
+      openTokenPosStack_[openTokenDepth] = nullptr;
+    }
+  }
+
   void templateString() {
-    while (pos++ < end) {
-      char ch = *pos;
-      if (ch == '$' && *(pos + 1) == '{') {
-        pos++;
-        if (templateStackDepth >= STACK_DEPTH) {
-          syntaxError(lexer_error::TEMPLATE_NEST_OVERFLOW);
-          return;
-        }
-        templateStack_[templateStackDepth++] = templateDepth;
-        templateDepth = ++openTokenDepth;
-        return;
-      }
-      if (ch == '`')
+    pos = kernels->find_template_end(pos + 1, end);
+    if (pos >= end) {
+      syntaxError(lexer_error::UNTERMINATED_TEMPLATE_STRING);
+      return;
+    }
+    if (*pos == '$') {
+      pos++;
+      if (templateStackDepth >= STACK_DEPTH) {
+        syntaxError(lexer_error::TEMPLATE_NEST_OVERFLOW);
         return;
-      if (ch == '\\' && pos + 1 < end) {
-        pos++;
-        countNewline(*pos);
-      } else {
-        countNewline(ch);
       }
+      templateStack_[templateStackDepth++] = templateDepth;
+      // The substitution opens a brace like any other, so record it for the
+      // regex check after a mismatched ')' closes it.
+      pushOpenToken(OpenToken::Substitution, pos);
+      templateDepth = openTokenDepth;
     }
-    syntaxError(lexer_error::UNTERMINATED_TEMPLATE_STRING);
   }
 
-  bool identifier(char startCh) {
-    if (!isIdentifierStart(static_cast<uint8_t>(startCh)))
+  bool identifier(Char startCh) {
+    if (!isIdentifierStart(startCh))
       return false;
     pos++;
     while (pos < end) {
-      char ch = *pos;
-      if (isIdentifierChar(static_cast<uint8_t>(ch))) {
+      Char ch = *pos;
+      if (isIdentifierChar(ch)) {
         pos++;
       } else {
         break;
@@ -638,67 +900,123 @@ private:
 #endif
   }
 
-  void addExport(std::string_view export_name, uint32_t at_line) {
+  // Calls `add` with the UTF-8 export name for the source text `name`, which
+  // may still be quoted: a view of the source when it can be used as it is,
+  // an unescaped or transcoded copy otherwise. Names with invalid escape
+  // sequences or lone surrogates are skipped.
+  template <typename Add>
+  void withExportName(view name, Add add) {
     // Skip surrounding quotes if present
-    if (!export_name.empty() && (export_name.front() == '\'' || export_name.front() == '"')) {
-      export_name.remove_prefix(1);
-      export_name.remove_suffix(1);
+    if (!name.empty() && (name.front() == '\'' || name.front() == '"')) {
+      name.remove_prefix(1);
+      name.remove_suffix(1);
     }
 
-    // Fast path: no escaping needed, use string_view directly
-    if (!needsUnescaping(export_name)) {
-      // Check if this export already exists (avoid duplicates)
-      for (const auto& existing : exports) {
-        if (get_string_view(existing.name) == export_name) {
-          return; // Already exists, skip
+    if constexpr (kUtf8) {
+      withUtf8ExportName(name, add);
+    } else {
+      if constexpr (std::is_same_v<Input, latin1_input>) {
+        // Most names are ASCII, and can be used in place.
+        if (Input::is_ascii(name)) {
+          withUtf8ExportName(name, add);
+          return;
         }
       }
-      exports.push_back(export_entry{export_name, at_line});
+      // Escapes are ASCII and survive transcoding, so transcode first.
+      auto utf8 = Input::to_utf8(name);
+      if (!utf8.has_value()) {
+        return;
+      }
+      if (!needsUnescaping(*utf8)) {
+        add(std::move(utf8.value()));
+        return;
+      }
+      auto unescaped = unescapeJsString(*utf8);
+      if (unescaped.has_value()) {
+        add(std::move(unescaped.value()));
+      }
+    }
+  }
+
+  template <typename Add>
+  void withUtf8ExportName(std::string_view name, Add& add) {
+    // Fast path: no escaping needed, use string_view directly
+    if (!needsUnescaping(name)) {
+      add(name);
       return;
     }
 
     // Slow path: unescape the export name (handles \u{XXXX}, \uHHHH, etc.)
     // Returns nullopt for invalid sequences like lone surrogates
-    auto unescaped = unescapeJsString(export_name);
-    if (!unescaped.has_value()) {
-      return;  // Skip invalid escape sequences
+    auto unescaped = unescapeJsString<name_string>(name, exports.get_allocator());
+    if (unescaped.has_value()) {
+      add(std::move(unescaped.value()));
     }
+  }
 
-    const std::string& name = unescaped.value();
+  void addExport(view export_name) {
+    withExportName(export_name, [this](auto&& name) { addUniqueExport(std::forward<decltype(name)>(name)); });
+  }
 
-    // Check if this export already exists (avoid duplicates)
-    for (const auto& existing : exports) {
-      if (get_string_view(existing.name) == name) {
-        return; // Already exists, skip
+  // Appends an export unless one with the same name exists: the first one
+  // found wins. Small modules are searched linearly; once they reach
+  // EXPORT_INDEX_MIN_SIZE exports, exportIndex_ takes over.
+  template <typename Name>
+  void addUniqueExport(Name&& name) {
+    std::string_view key = name;
+    if (exportIndex_.empty()) {
+      for (const auto& existing : exports) {
+        if (get_string_view(existing.name) == key) {
+          return;
+        }
+      }
+      exports.push_back(entry_type{std::forward<Name>(name), offset()});
+      if (exports.size() >= EXPORT_INDEX_MIN_SIZE) {
+        rebuildExportIndex();
       }
+      return;
     }
-    exports.push_back(export_entry{std::move(unescaped.value()), at_line});
-  }
 
-  void addReexport(std::string_view reexport_name, uint32_t at_line) {
-    // Skip surrounding quotes if present
-    if (!reexport_name.empty() && (reexport_name.front() == '\'' || reexport_name.front() == '"')) {
-      reexport_name.remove_prefix(1);
-      reexport_name.remove_suffix(1);
+    size_t slot = findExportSlot(key);
+    if (exportIndex_[slot] != 0) {
+      return;
     }
+    exports.push_back(entry_type{std::forward<Name>(name), offset()});
+    if (exports.size() * 2 > exportIndex_.size()) {
+      rebuildExportIndex();
+    } else {
+      exportIndex_[slot] = static_cast<uint32_t>(exports.size());
+    }
+  }
 
-    // Fast path: no escaping needed, use string_view directly
-    if (!needsUnescaping(reexport_name)) {
-      re_exports.push_back(export_entry{reexport_name, at_line});
-      return;
+  // The slot of exportIndex_ holding the export called `name`, or the empty
+  // slot where it belongs.
+  size_t findExportSlot(std::string_view name) const {
+    size_t mask = exportIndex_.size() - 1;
+    for (size_t slot = std::hash<std::string_view>{}(name) & mask;; slot = (slot + 1) & mask) {
+      uint32_t entry = exportIndex_[slot];
+      if (entry == 0 || get_string_view(exports[entry - 1].name) == name) {
+        return slot;
+      }
     }
+  }
 
-    // Slow path: unescape the reexport name
-    auto unescaped = unescapeJsString(reexport_name);
-    if (!unescaped.has_value()) {
-      return;  // Skip invalid escape sequences
+  // Sizes exportIndex_ to a quarter full and reinserts every export.
+  void rebuildExportIndex() {
+    exportIndex_.assign(std::bit_ceil(exports.size() * 4), 0);
+    for (size_t i = 0; i < exports.size(); i++) {
+      exportIndex_[findExportSlot(get_string_view(exports[i].name))] = static_cast<uint32_t>(i + 1);
     }
+  }
 
-    re_exports.push_back(export_entry{std::move(unescaped.value()), at_line});
+  void addReexport(view reexport_name) {
+    withExportName(reexport_name, [this](auto&& name) {
+      re_exports.push_back(entry_type{std::forward<decltype(name)>(name), offset()});
+    });
   }
 
-  bool readExportsOrModuleDotExports(char ch) {
-    const char* revertPos = pos;
+  bool readExportsOrModuleDotExports(Char ch) {
+    const Char* revertPos = pos;
     if (ch == 'm' && matchesAt(pos + 1, end, "odule")) {
       pos += 6;
       ch = commentWhitespace();
@@ -718,29 +1036,29 @@ private:
   }
 
   bool tryParseRequire(RequireType requireType) {
-    const char* revertPos = pos;
+    const Char* revertPos = pos;
     if (!matchesAt(pos + 1, end, "equire")) {
       return false;
     }
     pos += 7;
-    char ch = commentWhitespace();
+    Char ch = commentWhitespace();
     if (ch == '(') {
       pos++;
       ch = commentWhitespace();
-      const char* reexportStart = pos;
+      const Char* reexportStart = pos;
       if (ch == '\'' || ch == '"') {
         stringLiteral(ch);
-        const char* reexportEnd = ++pos;
+        const Char* reexportEnd = ++pos;
         ch = commentWhitespace();
         if (ch == ')') {
           switch (requireType) {
             case RequireType::ExportStar:
             case RequireType::ExportAssign:
-              addReexport(std::string_view(reexportStart, reexportEnd - reexportStart), line);
+              addReexport(view(reexportStart, reexportEnd - reexportStart));
               return true;
             default:
               if (starExportStack < STAR_EXPORT_STACK_END) {
-                starExportStack->specifier = std::string_view(reexportStart, reexportEnd - reexportStart);
+                starExportStack->specifier = view(reexportStart, reexportEnd - reexportStart);
               }
               return true;
           }
@@ -752,25 +1070,25 @@ private:
   }
 
   // Helper to parse property value in object literal (identifier or require())
-  bool tryParsePropertyValue(char& ch) {
+  bool tryParsePropertyValue(Char& ch) {
     if (ch == 'r' && tryParseRequire(RequireType::ExportAssign)) {
-      ch = *pos;
+      ch = charAt(pos);
       return true;
     }
     if (identifier(ch)) {
-      ch = *pos;
+      ch = charAt(pos);
       return true;
     }
     return false;
   }
 
   void tryParseLiteralExports() {
-    const char* revertPos = pos - 1;
+    const Char* revertPos = pos - 1;
     while (pos++ < end) {
-      char ch = commentWhitespace();
-      const char* startPos = pos;
+      Char ch = commentWhitespace();
+      const Char* startPos = pos;
       if (identifier(ch)) {
-        const char* endPos = pos;
+        const Char* endPos = pos;
         ch = commentWhitespace();
 
         // Check if this is a getter syntax: get identifier()
@@ -797,11 +1115,11 @@ private:
             return;
           }
         }
-        addExport(std::string_view(startPos, endPos - startPos), line);
+        addExport(view(startPos, endPos - startPos));
       } else if (ch == '\'' || ch == '"') {
-        const char* start = pos;
+        const Char* start = pos;
         stringLiteral(ch);
-        const char* end_pos = ++pos;
+        const Char* end_pos = ++pos;
         ch = commentWhitespace();
         if (ch == ':') {
           pos++;
@@ -810,7 +1128,7 @@ private:
             pos = revertPos;
             return;
           }
-          addExport(std::string_view(start, end_pos - start), line);
+          addExport(view(start, end_pos - start));
         }
       } else if (ch == '.' && matchesAt(pos + 1, end, "..")) {
         pos += 3;
@@ -838,18 +1156,18 @@ private:
 
   void tryParseExportsDotAssign(bool assign) {
     pos += 7;
-    const char* revertPos = pos - 1;
-    char ch = commentWhitespace();
+    const Char* revertPos = pos - 1;
+    Char ch = commentWhitespace();
     switch (ch) {
       case '.': {
         pos++;
         ch = commentWhitespace();
-        const char* startPos = pos;
+        const Char* startPos = pos;
         if (identifier(ch)) {
-          const char* endPos = pos;
+          const Char* endPos = pos;
           ch = commentWhitespace();
           if (ch == '=') {
-            addExport(std::string_view(startPos, endPos - startPos), line);
+            addExport(view(startPos, endPos - startPos));
             return;
           }
         }
@@ -859,15 +1177,15 @@ private:
         pos++;
         ch = commentWhitespace();
         if (ch == '\'' || ch == '"') {
-          const char* startPos = pos;
+          const Char* startPos = pos;
           stringLiteral(ch);
-          const char* endPos = ++pos;
+          const Char* endPos = ++pos;
           ch = commentWhitespace();
           if (ch != ']') break;
           pos++;
           ch = commentWhitespace();
           if (ch != '=') break;
-          addExport(std::string_view(startPos, endPos - startPos), line);
+          addExport(view(startPos, endPos - startPos));
         }
         break;
       }
@@ -891,8 +1209,8 @@ private:
 
   void tryParseModuleExportsDotAssign() {
     pos += 6;
-    const char* revertPos = pos - 1;
-    char ch = commentWhitespace();
+    const Char* revertPos = pos - 1;
+    Char ch = commentWhitespace();
     if (ch == '.') {
       pos++;
       ch = commentWhitespace();
@@ -904,8 +1222,8 @@ private:
     pos = revertPos;
   }
 
-  bool tryParseObjectHasOwnProperty(std::string_view it_id) {
-    char ch = commentWhitespace();
+  bool tryParseObjectHasOwnProperty(view it_id) {
+    Char ch = commentWhitespace();
     if (ch != 'O' || !matchesAt(pos + 1, end, "bject")) return false;
     pos += 6;
     ch = commentWhitespace();
@@ -947,14 +1265,14 @@ private:
 
   void tryParseObjectDefineOrKeys(bool keys) {
     pos += 6;
-    const char* revertPos = pos - 1;
-    char ch = commentWhitespace();
+    const Char* revertPos = pos - 1;
+    Char ch = commentWhitespace();
     if (ch == '.') {
       pos++;
       ch = commentWhitespace();
       if (ch == 'd' && matchesAt(pos + 1, end, "efineProperty")) {
-        const char* exportStart = nullptr;
-        const char* exportEnd = nullptr;
+        const Char* exportStart = nullptr;
+        const Char* exportEnd = nullptr;
         while (true) {
           pos += 14;
           revertPos = pos - 1;
@@ -998,7 +1316,7 @@ private:
             ch = commentWhitespace();
             if (ch != ':') break;
             if (exportStart && exportEnd)
-              addExport(std::string_view(exportStart, exportEnd - exportStart), line);
+              addExport(view(exportStart, exportEnd - exportStart));
             pos = revertPos;
             return;
           } else if (ch == 'g') {
@@ -1011,7 +1329,7 @@ private:
               if (ch != 'f') break;
               if (!matchesAt(pos + 1, end, "unction")) break;
               pos += 8;
-              const char* lastPos = pos;
+              const Char* lastPos = pos;
               ch = commentWhitespace();
               if (ch != '(' && (lastPos == pos || !identifier(ch))) break;
               ch = commentWhitespace();
@@ -1066,7 +1384,7 @@ private:
             ch = commentWhitespace();
             if (ch != ')') break;
             if (exportStart && exportEnd)
-              addExport(std::string_view(exportStart, exportEnd - exportStart), line);
+              addExport(view(exportStart, exportEnd - exportStart));
             return;
           }
           break;
@@ -1079,9 +1397,9 @@ private:
           if (ch != '(') break;
           pos++;
           ch = commentWhitespace();
-          const char* id_pos = pos;
+          const Char* id_pos = pos;
           if (!identifier(ch)) break;
-          std::string_view id(id_pos, static_cast<size_t>(pos - id_pos));
+          view id(id_pos, static_cast<size_t>(pos - id_pos));
           ch = commentWhitespace();
           if (ch != ')') break;
 
@@ -1103,9 +1421,9 @@ private:
           if (ch != '(') break;
           pos++;
           ch = commentWhitespace();
-          const char* it_id_pos = pos;
+          const Char* it_id_pos = pos;
           if (!identifier(ch)) break;
-          std::string_view it_id(it_id_pos, static_cast<size_t>(pos - it_id_pos));
+          view it_id(it_id_pos, static_cast<size_t>(pos - it_id_pos));
           ch = commentWhitespace();
           if (ch != ')') break;
           pos++;
@@ -1113,7 +1431,7 @@ private:
           if (ch != '{') break;
           pos++;
           ch = commentWhitespace();
-          if (ch != 'i' || *(pos + 1) != 'f') break;
+          if (ch != 'i' || charAt(pos + 1) != 'f') break;
           pos += 2;
           ch = commentWhitespace();
           if (ch != '(') break;
@@ -1128,14 +1446,14 @@ private:
             pos += 3;
             ch = commentWhitespace();
             if (ch != '"' && ch != '\'') break;
-            char quot = ch;
+            Char quot = ch;
             if (!matchesAt(pos + 1, end, "default")) break;
             pos += 8;
             ch = commentWhitespace();
             if (ch != quot) break;
             pos++;
             ch = commentWhitespace();
-            if (ch != '|' || *(pos + 1) != '|') break;
+            if (ch != '|' || charAt(pos + 1) != '|') break;
             pos += 2;
             ch = commentWhitespace();
             if (!matchesAt(pos, end, it_id)) break;
@@ -1162,13 +1480,13 @@ private:
               pos++;
             ch = commentWhitespace();
 
-            if (ch == 'i' && *(pos + 1) == 'f') {
+            if (ch == 'i' && charAt(pos + 1) == 'f') {
               bool inIf = true;
               pos += 2;
               ch = commentWhitespace();
               if (ch != '(') break;
               pos++;
-              const char* ifInnerPos = pos;
+              const Char* ifInnerPos = pos;
 
               if (tryParseObjectHasOwnProperty(it_id)) {
                 ch = commentWhitespace();
@@ -1181,7 +1499,7 @@ private:
                 if (ch == ';')
                   pos++;
                 ch = commentWhitespace();
-                if (ch == 'i' && *(pos + 1) == 'f') {
+                if (ch == 'i' && charAt(pos + 1) == 'f') {
                   pos += 2;
                   ch = commentWhitespace();
                   if (ch != '(') break;
@@ -1202,7 +1520,7 @@ private:
                 ch = commentWhitespace();
                 if (!readExportsOrModuleDotExports(ch)) break;
                 ch = commentWhitespace();
-                if (ch != '&' || *(pos + 1) != '&') break;
+                if (ch != '&' || charAt(pos + 1) != '&') break;
                 pos += 2;
                 ch = commentWhitespace();
                 if (!readExportsOrModuleDotExports(ch)) break;
@@ -1247,7 +1565,7 @@ private:
             pos += 3;
             ch = commentWhitespace();
             if (ch != '"' && ch != '\'') break;
-            char quot = ch;
+            Char quot = ch;
             if (!matchesAt(pos + 1, end, "default")) break;
             pos += 8;
             ch = commentWhitespace();
@@ -1255,7 +1573,7 @@ private:
             pos++;
             ch = commentWhitespace();
             if (ch == '&') {
-              if (*(pos + 1) != '&') break;
+              if (charAt(pos + 1) != '&') break;
               pos += 2;
               ch = commentWhitespace();
               if (ch != '!') break;
@@ -1367,7 +1685,7 @@ private:
               if (ch != 'f') break;
               if (!matchesAt(pos + 1, end, "unction")) break;
               pos += 8;
-              const char* lastPos = pos;
+              const Char* lastPos = pos;
               ch = commentWhitespace();
               if (ch != '(' && (lastPos == pos || !identifier(ch))) break;
               ch = commentWhitespace();
@@ -1430,7 +1748,7 @@ private:
           StarExportBinding* curCheckBinding = &starExportStack_[0];
           while (curCheckBinding != starExportStack) {
             if (curCheckBinding->id == id) {
-              addReexport(curCheckBinding->specifier, line);
+              addReexport(curCheckBinding->specifier);
               pos = revertPos;
               return;
             }
@@ -1443,26 +1761,28 @@ private:
     pos = revertPos;
   }
 
-  void tryBacktrackAddStarExportBinding(const char* bPos) {
+  void tryBacktrackAddStarExportBinding(const Char* bPos) {
+    if (bPos < source)
+      return;
     while (*bPos == ' ' && bPos > source)
       bPos--;
-    if (*bPos == '=') {
+    if (*bPos == '=' && bPos > source) {
       bPos--;
       while (*bPos == ' ' && bPos > source)
         bPos--;
-      const char* id_end = bPos;
+      const Char* id_end = bPos;
       bool identifierStart = false;
       while (bPos > source) {
-        char ch = *bPos;
-        if (!isIdentifierChar(static_cast<uint8_t>(ch)))
+        Char ch = *bPos;
+        if (!isIdentifierChar(ch))
           break;
-        identifierStart = isIdentifierStart(static_cast<uint8_t>(ch));
+        identifierStart = isIdentifierStart(ch);
         bPos--;
       }
       if (identifierStart && *bPos == ' ') {
         if (starExportStack == STAR_EXPORT_STACK_END)
           return;
-        starExportStack->id = std::string_view(bPos + 1, static_cast<size_t>(id_end - bPos));
+        starExportStack->id = view(bPos + 1, static_cast<size_t>(id_end - bPos));
         while (*bPos == ' ' && bPos > source)
           bPos--;
         switch (*bPos) {
@@ -1483,12 +1803,12 @@ private:
   }
 
   void throwIfImportStatement() {
-    const char* startPos = pos;
+    const Char* startPos = pos;
     pos += 6;
-    char ch = commentWhitespace();
+    Char ch = commentWhitespace();
     switch (ch) {
       case '(':
-        openTokenPosStack_[openTokenDepth++] = startPos;
+        pushOpenToken(OpenToken::Paren, startPos);
         return;
       case '.':
         // Check if followed by 'meta' (possibly with whitespace)
@@ -1497,10 +1817,12 @@ private:
         // Use str_eq4 for more efficient comparison
         if (ch == 'm' && pos + 4 <= end && matchesAt(pos + 1, end, "eta")) {
           // Check that 'meta' is not followed by an identifier character
-          if (pos + 4 < end && isIdentifierChar(static_cast<uint8_t>(pos[4]))) {
+          if (pos + 4 < end && isIdentifierChar(pos[4])) {
             // It's something like import.metaData, not import.meta
             return;
           }
+          // Report the statement, not the token after it.
+          pos = startPos;
           syntaxError(lexer_error::UNEXPECTED_ESM_IMPORT_META);
         }
         return;
@@ -1516,30 +1838,143 @@ private:
           pos--;
           return;
         }
+        pos = startPos;
         syntaxError(lexer_error::UNEXPECTED_ESM_IMPORT);
     }
   }
 
   void throwIfExportStatement() {
+    const Char* startPos = pos;
     pos += 6;
-    const char* curPos = pos;
-    char ch = commentWhitespace();
+    const Char* curPos = pos;
+    Char ch = commentWhitespace();
     if (pos == curPos && !isPunctuator(ch))
       return;
+    pos = startPos;
     syntaxError(lexer_error::UNEXPECTED_ESM_EXPORT);
   }
 
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+  // First byte at or after `p` that stage 1 marks, or end. `p` never moves
+  // backwards, so only the current block's mask has to be kept.
+  const Char* nextStructural(const Char* p) {
+    size_t offset = static_cast<size_t>(p - source);
+    size_t length = static_cast<size_t>(end - source);
+    for (;;) {
+      size_t delta = offset - structuralBlock_;
+      if (delta >= structuralBlockSize_) {
+        structuralBlock_ = offset;
+        if (delta != structuralBlockSize_) {
+          // Strings, comments and templates are skipped by their own
+          // kernels, and the code between them is often only a few bytes
+          // long. Walk a short window byte by byte first and only classify
+          // once the run of code continues past it.
+          structuralBlockSize_ = 16;
+          structuralCheck = length - offset > 16 ? p + 16 : end;
+          return p;
+        }
+        structuralBlockSize_ = 64;
+        structuralMask_ = kernels->structural_block(p, end, offset ? source[offset - 1] : '\0');
+        delta = 0;
+      }
+      uint64_t bits = structuralMask_ >> delta;
+      if (bits) {
+        p += std::countr_zero(bits);
+        structuralCheck = p + 1;
+        return p;
+      }
+      offset = structuralBlock_ + structuralBlockSize_;
+      if (offset >= length) {
+        structuralCheck = end;
+        return end;
+      }
+      p = source + offset;
+    }
+  }
+
+  // Jumps over [pos, next), which holds no line terminators and nothing the
+  // main loop reacts to, leaving pos just before `next`. The only state the
+  // skipped bytes would have touched is lastTokenPos.
+  void skipUnstructured(const Char* next) {
+    for (const Char* p = next - 1; p >= pos; p--) {
+      if (!(*p == ' ' || (*p < 14 && *p > 8))) {
+        lastTokenPos = p;
+        break;
+      }
+    }
+    pos = next - 1;
+  }
+#endif
+
 public:
-  CJSLexer(std::vector<export_entry>& out_exports, std::vector<export_entry>& out_re_exports)
+  CJSLexer(entry_list& out_exports, entry_list& out_re_exports)
     : source(nullptr), pos(nullptr), end(nullptr), lastTokenPos(nullptr),
       templateStackDepth(0), openTokenDepth(0), templateDepth(0),
-      line(1),
       lastSlashWasDivision(false), nextBraceIsClass(false),
-      templateStack_{}, openTokenPosStack_{}, openClassPosStack{},
-      starExportStack_{}, starExportStack(nullptr), STAR_EXPORT_STACK_END(nullptr),
-      exports(out_exports), re_exports(out_re_exports) {}
+      templateStack_{}, openTokenPosStack_{}, openTokenKind_{},
+      starExportStack_{}, starExportStack(nullptr), STAR_EXPORT_STACK_END(nullptr), kernels(nullptr), error_(), errorPos_(nullptr),
+      validatedEnd_(nullptr),
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+      structuralCheck(nullptr), structuralBlock_(0), structuralBlockSize_(0), structuralMask_(0),
+#endif
+      exports(out_exports), re_exports(out_re_exports), exportIndex_() {}
+
+  CJSLexer(const CJSLexer&) = delete;
+  CJSLexer& operator=(const CJSLexer&) = delete;
+
+  bool parse(view file_contents) {
+    bool ok = lexSource(file_contents);
+    if constexpr (kValidateUtf8) {
+      // Invalid UTF-8 takes precedence over any other error, also one found
+      // before it, so the rest of the source is validated either way.
+      if (error_ != lexer_error::INVALID_UTF8 && error_ != lexer_error::SOURCE_TOO_LARGE) {
+        const Char* invalid = findInvalidUtf8(validatedEnd_, end);
+        if (invalid != end) {
+          invalidUtf8(invalid);
+          return false;
+        }
+      }
+    }
+    return ok;
+  }
+
+private:
+  void invalidUtf8(const Char* at) {
+    error_ = lexer_error::INVALID_UTF8;
+    errorPos_ = at;
+    pos = end + 1;
+  }
 
-  bool parse(std::string_view file_contents) {
+  // Validates the source from validatedEnd_ to a chunk past pos. Returns
+  // false if it is invalid.
+  bool validateAhead() {
+    const Char* chunkEnd =
+        static_cast<size_t>(end - pos) > UTF8_VALIDATION_CHUNK_SIZE ? pos + UTF8_VALIDATION_CHUNK_SIZE : end;
+    // Leave a sequence that straddles the chunk end to the next chunk.
+    for (int i = 0; i < 3 && chunkEnd < end && (static_cast<unsigned char>(*chunkEnd) & 0xC0) == 0x80; i++) {
+      chunkEnd--;
+    }
+    const Char* invalid = findInvalidUtf8(validatedEnd_, chunkEnd);
+    if (invalid != chunkEnd) {
+      invalidUtf8(invalid);
+      return false;
+    }
+    validatedEnd_ = chunkEnd;
+    return true;
+  }
+
+  bool lexSource(view file_contents) {
+    if constexpr (sizeof(Char) == 1) {
+      kernels = &scan::active_kernels();
+    } else {
+      kernels = &scan::utf16_kernels();
+    }
+    // An empty view may have null data, e.g. from an empty file, and null - 1
+    // below is undefined.
+    static constexpr Char empty[1] = {};
+    if (file_contents.data() == nullptr) {
+      file_contents = view(empty, 0);
+    }
     source = file_contents.data();
     pos = source - 1;
     end = source + file_contents.size();
@@ -1549,14 +1984,33 @@ public:
 
     templateStackDepth = 0;
     openTokenDepth = 0;
+    openTokenPosStack_[0] = nullptr;
     templateDepth = std::numeric_limits<uint16_t>::max();
-    line = 1;
     lastSlashWasDivision = false;
     starExportStack = &starExportStack_[0];
     STAR_EXPORT_STACK_END = &starExportStack_[MAX_STAR_EXPORTS - 1];
     nextBraceIsClass = false;
+    exportIndex_.clear();
+    error_.reset();
+    validatedEnd_ = source;
+
+    // Offsets and line numbers are stored in 32 bits.
+    if (file_contents.size() > std::numeric_limits<uint32_t>::max()) {
+      syntaxError(lexer_error::SOURCE_TOO_LARGE);
+      return false;
+    }
+
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+    // Stage 1 takes every byte >= 0x80 for part of an identifier, which only
+    // holds for UTF-8.
+    bool useStructuralIndex = kUtf8 &&
+                              file_contents.size() >= STRUCTURAL_INDEX_MIN_SIZE && kernels->structural_block;
+    structuralCheck = useStructuralIndex ? source : end;
+    structuralBlock_ = 0;
+    structuralBlockSize_ = 0;
+#endif
 
-    char ch = '\0';
+    Char ch = '\0';
 
     // Handle shebang
     if (file_contents.size() >= 2 && source[0] == '#' && source[1] == '!') {
@@ -1572,11 +2026,25 @@ public:
       lastTokenPos = pos;  // Update lastTokenPos after shebang
     }
 
-    while (pos++ < end) {
+    while (++pos < end) {
+      if constexpr (kValidateUtf8) {
+        if (pos >= validatedEnd_ && !validateAhead())
+          return false;
+      }
+#ifdef MERVE_USE_STRUCTURAL_INDEX
+      if (pos >= structuralCheck) {
+        const Char* next = nextStructural(pos);
+        if (next != pos) {
+          skipUnstructured(next);
+          continue;
+        }
+      }
+#endif
+
       ch = *pos;
 
-      if (ch == ' ' || (ch < 14 && ch > 8)) {
-        countNewline(ch);
+      // Whitespace is the most common byte in readable code.
+      if (ch == ' ' || (ch < 14 && ch > 8)) [[likely]] {
         continue;
       }
 
@@ -1588,7 +2056,7 @@ public:
             lastTokenPos = pos;
             continue;
           case 'r': {
-            const char* startPos = pos;
+            const Char* startPos = pos;
             if (tryParseRequire(RequireType::Import) && keywordStart(startPos))
               tryBacktrackAddStarExportBinding(startPos - 1);
             lastTokenPos = pos;
@@ -1596,11 +2064,11 @@ public:
           }
           case '_':
             if (pos + 23 < end && matchesAt(pos + 1, end, "interopRequireWildcard") && (keywordStart(pos) || *(pos - 1) == '.')) {
-              const char* startPos = pos;
+              const Char* startPos = pos;
               pos += 23;
               if (*pos == '(') {
                 pos++;
-                openTokenPosStack_[openTokenDepth++] = lastTokenPos;
+                pushOpenToken(OpenToken::Paren, lastTokenPos);
                 if (tryParseRequire(RequireType::Import) && keywordStart(startPos))
                   tryBacktrackAddStarExportBinding(startPos - 1);
               }
@@ -1609,8 +2077,8 @@ public:
               if (pos + 4 < end && matchesAt(pos, end, "Star"))
                 pos += 4;
               if (*pos == '(') {
-                openTokenPosStack_[openTokenDepth++] = lastTokenPos;
-                if (*(pos + 1) == 'r') {
+                pushOpenToken(OpenToken::Paren, lastTokenPos);
+                if (charAt(pos + 1) == 'r') {
                   pos++;
                   tryParseRequire(RequireType::ExportStar);
                 }
@@ -1631,7 +2099,7 @@ public:
           }
           break;
         case 'c':
-          if (keywordStart(pos) && matchesAt(pos + 1, end, "lass") && isBrOrWs(*(pos + 5)))
+          if (keywordStart(pos) && matchesAt(pos + 1, end, "lass") && isBrOrWs(charAt(pos + 5)))
             nextBraceIsClass = true;
           break;
         case 'm':
@@ -1643,7 +2111,7 @@ public:
             tryParseObjectDefineOrKeys(openTokenDepth == 0);
           break;
         case '(':
-          openTokenPosStack_[openTokenDepth++] = lastTokenPos;
+          pushOpenToken(OpenToken::Paren, lastTokenPos);
           break;
         case ')':
           if (openTokenDepth == 0) {
@@ -1653,9 +2121,8 @@ public:
           openTokenDepth--;
           break;
         case '{':
-          openClassPosStack[openTokenDepth] = nextBraceIsClass;
+          pushOpenToken(nextBraceIsClass ? OpenToken::ClassBrace : OpenToken::Brace, lastTokenPos);
           nextBraceIsClass = false;
-          openTokenPosStack_[openTokenDepth++] = lastTokenPos;
           break;
         case '}':
           if (openTokenDepth == 0) {
@@ -1677,7 +2144,7 @@ public:
           stringLiteral(ch);
           break;
         case '/': {
-          char next_ch = pos + 1 < end ? *(pos + 1) : '\0';
+          Char next_ch = pos + 1 < end ? *(pos + 1) : '\0';
           if (next_ch == '/') {
             lineComment();
             continue;
@@ -1687,14 +2154,19 @@ public:
           } else {
             // Check if lastTokenPos is before the source (start of input)
             bool isStartOfInput = lastTokenPos < source;
-            char lastToken = isStartOfInput ? '\0' : *lastTokenPos;
+            Char lastToken = isStartOfInput ? '\0' : *lastTokenPos;
+            // The token that opened the group lastToken closed. The slot is
+            // unset (or left over from an earlier parse) when lastToken was
+            // skipped over rather than lexed, as in "_interopRequireWildcard)".
+            const Char* openPos = openTokenPosStack_[openTokenDepth];
+            bool openInSource = openPos >= source && openPos < end;
 
             if ((isExpressionPunctuator(lastToken) &&
                  !(lastToken == '.' && lastTokenPos > source && *(lastTokenPos - 1) >= '0' && *(lastTokenPos - 1) <= '9') &&
                  !(lastToken == '+' && lastTokenPos > source && *(lastTokenPos - 1) == '+') &&
                  !(lastToken == '-' && lastTokenPos > source && *(lastTokenPos - 1) == '-')) ||
-                (lastToken == ')' && isParenKeyword(openTokenPosStack_[openTokenDepth])) ||
-                (lastToken == '}' && (openTokenPosStack_[openTokenDepth] < source || isExpressionTerminator(openTokenPosStack_[openTokenDepth]) || openClassPosStack[openTokenDepth])) ||
+                (lastToken == ')' && openInSource && isParenKeyword(openPos)) ||
+                (lastToken == '}' && (!openInSource || isExpressionTerminator(openPos) || openTokenKind_[openTokenDepth] == OpenToken::ClassBrace)) ||
                 (lastToken == '/' && lastSlashWasDivision) ||
                 (!isStartOfInput && isExpressionKeyword(lastTokenPos)) ||
                 !lastToken || isStartOfInput) {
@@ -1717,29 +2189,258 @@ public:
       lastTokenPos = pos;
     }
 
-    if (templateDepth != std::numeric_limits<uint16_t>::max() || openTokenDepth || last_error) {
+    if (error_) {
+      return false;
+    }
+    if (openTokenDepth) {
+      // Report the innermost token left open at the end of the input.
+      switch (openTokenKind_[openTokenDepth - 1]) {
+        case OpenToken::Paren:
+          syntaxError(lexer_error::UNTERMINATED_PAREN);
+          break;
+        case OpenToken::Brace:
+        case OpenToken::ClassBrace:
+          syntaxError(lexer_error::UNTERMINATED_BRACE);
+          break;
+        case OpenToken::Substitution:
+          syntaxError(lexer_error::UNTERMINATED_TEMPLATE_STRING);
+          break;
+      }
       return false;
     }
 
     return true;
   }
+
+public:
+  // The first syntax error of the last parse(), if it failed.
+  const std::optional<lexer_error>& error() const {
+    return error_;
+  }
+
+  // Where error() was detected, with the line counted like resolveLines()
+  // does. Only called after a failed parse, so the line is never counted
+  // on the success path.
+  error_location errorLocation() const {
+    uint32_t line = 1 + kernels->count_line_terminators(source, errorPos_);
+    if (errorPos_ > source && errorPos_ < end && errorPos_[-1] == '\r' && *errorPos_ == '\n') {
+      line--;
+    }
+    return error_location{static_cast<uint32_t>(errorPos_ - source), line};
+  }
+
+  // Replaces the offsets stored by addExport()/addReexport() with 1-based
+  // line numbers once parse() has succeeded.
+  void resolveLines() const {
+    resolveLines(exports);
+    resolveLines(re_exports);
+  }
+
+private:
+  // One plus the line terminators before each entry's offset, where CRLF
+  // counts once.
+  void resolveLines(entry_list& entries) const {
+    const Char* cursor = source;
+    uint32_t line = 1;
+    for (auto& entry : entries) {
+      const Char* at = std::min(source + entry.line, end);
+      if (at < cursor) {
+        // Backtracking can record entries out of order; count from the start.
+        cursor = source;
+        line = 1;
+      }
+      line += kernels->count_line_terminators(cursor, at);
+      // A CR right before `at` was counted as a line terminator, but the LF
+      // after it is the one that ends the line.
+      if (at > cursor && at < end && at[-1] == '\r' && *at == '\n') {
+        line--;
+        cursor = at - 1;
+      } else {
+        cursor = at;
+      }
+      entry.line = line;
+    }
+  }
 };
 
-std::optional<lexer_analysis> parse_commonjs(std::string_view file_contents) {
-  last_error.reset();
+namespace {
 
+template <typename Input>
+parse_result lex(std::basic_string_view<typename Input::code_unit> file_contents) {
   lexer_analysis result;
-  CJSLexer lexer(result.exports, result.re_exports);
+  CJSLexer<Input> lexer(result.exports, result.re_exports);
 
   if (lexer.parse(file_contents)) {
-    return result;  // NRVO or implicit move applies
+    lexer.resolveLines();
+    return parse_result(std::move(result));
   }
 
-  return std::nullopt;
+  return parse_result(*lexer.error(), lexer.errorLocation());
+}
+
+// Sets the thread-local error state from `result` and unwraps it.
+std::optional<lexer_analysis> recordLastError(parse_result&& result) {
+  if (!result) {
+    last_error = result.error();
+    last_error_location = result.location();
+    return std::nullopt;
+  }
+  last_error.reset();
+  last_error_location.reset();
+  return std::move(result).value();
+}
+
+}  // namespace
+
+std::optional<lexer_analysis> parse_commonjs(std::string_view file_contents) {
+  return recordLastError(parse_commonjs_result(file_contents));
+}
+
+parse_result parse_commonjs_result(std::string_view file_contents) {
+  return lex<utf8_input>(file_contents);
+}
+
+std::optional<lexer_analysis> parse_commonjs_latin1(std::string_view file_contents) {
+  return recordLastError(parse_commonjs_latin1_result(file_contents));
+}
+
+parse_result parse_commonjs_latin1_result(std::string_view file_contents) {
+  return lex<latin1_input>(file_contents);
+}
+
+std::optional<lexer_analysis> parse_commonjs_validated(std::string_view file_contents) {
+  return recordLastError(parse_commonjs_validated_result(file_contents));
+}
+
+parse_result parse_commonjs_validated_result(std::string_view file_contents) {
+  return lex<validated_utf8_input>(file_contents);
+}
+
+std::optional<lexer_analysis> parse_commonjs(std::u16string_view file_contents) {
+  return recordLastError(parse_commonjs_result(file_contents));
+}
+
+parse_result parse_commonjs_result(std::u16string_view file_contents) {
+  return lex<utf16_input>(file_contents);
+}
+
+std::shared_ptr<const lexer_analysis> parse_commonjs_shared(std::shared_ptr<const char[]> source, size_t length) {
+  auto result = parse_commonjs(std::string_view(source.get(), length));
+  if (!result) {
+    return nullptr;
+  }
+
+  // One allocation holds the analysis and the reference to its source; the
+  // returned pointer aliases the analysis inside it.
+  struct shared_state {
+    std::shared_ptr<const char[]> source;
+    lexer_analysis analysis;
+  };
+  auto state = std::make_shared<shared_state>(shared_state{std::move(source), std::move(*result)});
+  return std::shared_ptr<const lexer_analysis>(state, &state->analysis);
+}
+
+std::optional<pmr::lexer_analysis> parse_commonjs(std::string_view file_contents, std::pmr::memory_resource* resource) {
+  // Lexed straight into the result, so nothing but the lexer's hash index
+  // for large modules touches the heap.
+  pmr::lexer_analysis analysis{pmr::lexer_analysis::allocator_type(resource)};
+  CJSLexer<utf8_input, pmr::lexer_analysis> lexer(analysis.exports, analysis.re_exports);
+
+  if (!lexer.parse(file_contents)) {
+    last_error = lexer.error();
+    last_error_location = lexer.errorLocation();
+    return std::nullopt;
+  }
+  last_error.reset();
+  last_error_location.reset();
+  lexer.resolveLines();
+  return analysis;
+}
+
+compact_analysis::compact_analysis(const lexer_analysis& analysis, std::string_view source)
+    : source_(source), entries_(), arena_(), export_count_(analysis.exports.size()) {
+  // Without a source, names that point into it are copied as well.
+  auto inSource = [&source](const export_entry& entry) {
+    return source.data() != nullptr && std::holds_alternative<std::string_view>(entry.name);
+  };
+  size_t arena_size = 0;
+  for (const auto* entries : {&analysis.exports, &analysis.re_exports}) {
+    for (const auto& entry : *entries) {
+      if (!inSource(entry)) {
+        arena_size += get_string_view(entry).size();
+      }
+    }
+  }
+  entries_.reserve(analysis.exports.size() + analysis.re_exports.size());
+  arena_.reserve(arena_size);
+
+  for (const auto* entries : {&analysis.exports, &analysis.re_exports}) {
+    for (const auto& entry : *entries) {
+      std::string_view name = get_string_view(entry);
+      if (inSource(entry)) {
+        entries_.push_back(compact_export{static_cast<uint32_t>(name.data() - source.data()),
+                                          static_cast<uint32_t>(name.size()), entry.line, 0});
+      } else {
+        entries_.push_back(compact_export{static_cast<uint32_t>(arena_.size()), static_cast<uint32_t>(name.size()),
+                                          entry.line, compact_export::in_arena});
+        arena_.append(name);
+      }
+    }
+  }
+}
+
+std::optional<compact_analysis> parse_commonjs_compact(std::string_view file_contents) {
+  auto result = parse_commonjs(file_contents);
+  if (!result) {
+    return std::nullopt;
+  }
+  return compact_analysis(*result, file_contents);
+}
+
+struct parser::state {
+  lexer_analysis analysis{};
+  CJSLexer<utf8_input> lexer{analysis.exports, analysis.re_exports};
+};
+
+parser::parser() noexcept = default;
+parser::~parser() = default;
+parser::parser(parser&&) noexcept = default;
+parser& parser::operator=(parser&&) noexcept = default;
+
+const lexer_analysis* parser::parse(std::string_view file_contents) {
+  if (!state_) {
+    state_ = std::make_unique<state>();
+  }
+  // clear() keeps the capacity for the next module.
+  state_->analysis.exports.clear();
+  state_->analysis.re_exports.clear();
+
+  if (state_->lexer.parse(file_contents)) {
+    last_error.reset();
+    last_error_location.reset();
+    state_->lexer.resolveLines();
+    return &state_->analysis;
+  }
+
+  last_error = state_->lexer.error();
+  last_error_location = state_->lexer.errorLocation();
+  return nullptr;
+}
+
+std::optional<compact_analysis> parser::parse_compact(std::string_view file_contents) {
+  const lexer_analysis* result = parse(file_contents);
+  if (!result) {
+    return std::nullopt;
+  }
+  return compact_analysis(*result, file_contents);
 }
 
 const std::optional<lexer_error>& get_last_error() {
   return last_error;
 }
 
+const std::optional<error_location>& get_last_error_location() {
+  return last_error_location;
+}
+
 }  // namespace lexer
@@ -0,0 +1,303 @@
+#include "scan.h"
+#include "isadetection.h"
+#include "merve/implementation.h"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(MERVE_IS_X86_64)
+#include <immintrin.h>
+#elif defined(MERVE_IS_ARM64)
+#include <arm_neon.h>
+#endif
+
+// Compiles the functions between the two macros for the given instruction
+// sets, whatever the flags of the rest of the file. MSVC needs no opt-in to
+// use intrinsics.
+#define MERVE_STRINGIFY_IMPLEMENTATION_(a) #a
+#define MERVE_STRINGIFY(a) MERVE_STRINGIFY_IMPLEMENTATION_(a)
+#if defined(__clang__)
+#define MERVE_TARGET_REGION(T) \
+  _Pragma(MERVE_STRINGIFY(clang attribute push(__attribute__((target(T))), apply_to = function)))
+#define MERVE_UNTARGET_REGION _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define MERVE_TARGET_REGION(T) _Pragma("GCC push_options") _Pragma(MERVE_STRINGIFY(GCC target(T)))
+#define MERVE_UNTARGET_REGION _Pragma("GCC pop_options")
+#else
+#define MERVE_TARGET_REGION(T)
+#define MERVE_UNTARGET_REGION
+#endif
+
+namespace lexer::scan {
+
+// ============================================================================
+// Scalar kernels: the fallback implementation, and the tails of the others
+// ============================================================================
+
+namespace scalar {
+
+// Templated over the code unit type: the same code scans UTF-8 and UTF-16,
+// since only ASCII characters matter to the lexer.
+
+template <typename Char>
+inline uint32_t is_line_terminator(const Char* p, const Char* end) {
+  return (*p == '\n') || (*p == '\r' && (p + 1 >= end || p[1] != '\n'));
+}
+
+template <typename Char>
+inline bool is_template_special(const Char* p, const Char* end) {
+  return *p == '`' || *p == '\\' || (*p == '$' && p + 1 < end && p[1] == '{');
+}
+
+inline bool is_identifier_byte(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+         c == '$' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+template <typename Char>
+inline const Char* find_line_terminator(const Char* p, const Char* end) {
+  while (p < end && *p != '\n' && *p != '\r') {
+    p++;
+  }
+  return p;
+}
+
+template <typename Char>
+inline const Char* find_block_comment_end(const Char* p, const Char* end) {
+  for (; p < end; p++) {
+    if (*p == '*' && p + 1 < end && p[1] == '/') {
+      return p;
+    }
+  }
+  return end;
+}
+
+template <typename Char>
+inline const Char* find_quote_or_escape(const Char* p, const Char* end, Char quote) {
+  while (p < end && *p != quote && *p != '\\' && *p != '\n' && *p != '\r') {
+    p++;
+  }
+  return p;
+}
+
+template <typename Char>
+inline const Char* find_template_end(const Char* p, const Char* end) {
+  for (; p < end; p++) {
+    if (*p == '\\') {
+      // The escaped character never ends the literal.
+      if (++p == end) {
+        break;
+      }
+    } else if (is_template_special(p, end)) {
+      return p;
+    }
+  }
+  return end;
+}
+
+template <typename Char>
+inline uint32_t count_line_terminators(const Char* p, const Char* end) {
+  uint32_t lines = 0;
+  for (; p < end; p++) {
+    lines += is_line_terminator(p, end);
+  }
+  return lines;
+}
+
+const kernels kernel_table = {
+    find_line_terminator<char>,  find_block_comment_end<char>,  find_quote_or_escape<char>,
+    find_template_end<char>,     count_line_terminators<char>, nullptr,
+};
+
+const basic_kernels<char16_t> utf16_kernel_table = {
+    find_line_terminator<char16_t>,  find_block_comment_end<char16_t>,  find_quote_or_escape<char16_t>,
+    find_template_end<char16_t>,     count_line_terminators<char16_t>, nullptr,
+};
+
+}  // namespace scalar
+
+// ============================================================================
+// Vectorized kernels, one namespace per instruction set
+// ============================================================================
+
+#if defined(MERVE_IS_X86_64)
+
+MERVE_TARGET_REGION("avx512f,avx512bw,avx512vl,avx2,bmi,bmi2,popcnt")
+namespace avx512 {
+#include "simd/avx512.h"
+#include "generic/scan_kernels.h"
+}  // namespace avx512
+MERVE_UNTARGET_REGION
+
+MERVE_TARGET_REGION("avx2,bmi,bmi2,popcnt")
+namespace avx2 {
+#include "simd/avx2.h"
+#include "generic/scan_kernels.h"
+}  // namespace avx2
+MERVE_UNTARGET_REGION
+
+MERVE_TARGET_REGION("sse4.2,popcnt")
+namespace sse42 {
+#include "simd/sse42.h"
+#include "generic/scan_kernels.h"
+}  // namespace sse42
+MERVE_UNTARGET_REGION
+
+#elif defined(MERVE_IS_ARM64)
+
+namespace neon {
+#include "simd/neon.h"
+#include "generic/scan_kernels.h"
+}  // namespace neon
+
+#endif
+
+}  // namespace lexer::scan
+
+namespace lexer {
+
+// ============================================================================
+// Runtime dispatch
+// ============================================================================
+
+namespace {
+
+class kernel_implementation final : public implementation {
+ public:
+  constexpr kernel_implementation(std::string_view name, std::string_view description,
+                                  uint32_t required_instruction_sets, const scan::kernels& table) noexcept
+      : implementation(name, description, required_instruction_sets), table_(table) {}
+
+  const scan::kernels& table() const noexcept { return table_; }
+
+ private:
+  const scan::kernels& table_;
+};
+
+#if defined(MERVE_IS_X86_64)
+const kernel_implementation avx512_implementation{
+    "avx512bw", "Intel/AMD AVX-512BW",
+    internal::AVX512F | internal::AVX512BW | internal::AVX512VL | internal::AVX2 | internal::BMI1 |
+        internal::BMI2 | internal::POPCNT,
+    scan::avx512::kernel_table};
+const kernel_implementation avx2_implementation{
+    "avx2", "Intel/AMD AVX2", internal::AVX2 | internal::BMI1 | internal::BMI2 | internal::POPCNT,
+    scan::avx2::kernel_table};
+const kernel_implementation sse42_implementation{"sse42", "Intel/AMD SSE4.2",
+                                                 internal::SSE42 | internal::POPCNT,
+                                                 scan::sse42::kernel_table};
+#elif defined(MERVE_IS_ARM64)
+const kernel_implementation neon_implementation{"neon", "ARM NEON", internal::NEON, scan::neon::kernel_table};
+#endif
+const kernel_implementation scalar_implementation{"scalar", "Generic scalar code", internal::DEFAULT,
+                                                  scan::scalar::kernel_table};
+
+// Best first.
+const implementation* const available_implementations[] = {
+#if defined(MERVE_IS_X86_64)
+    &avx512_implementation,
+    &avx2_implementation,
+    &sse42_implementation,
+#elif defined(MERVE_IS_ARM64)
+    &neon_implementation,
+#endif
+    &scalar_implementation,
+};
+
+const kernel_implementation* find_supported_implementation(std::string_view name) {
+  for (const implementation* impl : available_implementations) {
+    if (impl->name() == name && impl->supported_by_runtime_system()) {
+      return static_cast<const kernel_implementation*>(impl);
+    }
+  }
+  return nullptr;
+}
+
+std::string forced_implementation_name() {
+#if defined(_MSC_VER)
+  char* value = nullptr;
+  size_t length = 0;
+  std::string name;
+  if (_dupenv_s(&value, &length, "MERVE_FORCE_IMPLEMENTATION") == 0 && value != nullptr) {
+    name = value;
+    std::free(value);
+  }
+  return name;
+#else
+  const char* value = std::getenv("MERVE_FORCE_IMPLEMENTATION");
+  return value ? value : "";
+#endif
+}
+
+const kernel_implementation& detect_best_implementation() {
+  std::string forced = forced_implementation_name();
+  if (!forced.empty()) {
+    if (const kernel_implementation* impl = find_supported_implementation(forced)) {
+      return *impl;
+    }
+  }
+  for (const implementation* impl : available_implementations) {
+    if (impl->supported_by_runtime_system()) {
+      return *static_cast<const kernel_implementation*>(impl);
+    }
+  }
+  return scalar_implementation;
+}
+
+// Null until first use. Detection only fills it in if nobody has set it in
+// the meantime, so it never overrides set_active_implementation().
+std::atomic<const kernel_implementation*> active_implementation{nullptr};
+
+const kernel_implementation& get_active_kernel_implementation() {
+  const kernel_implementation* impl = active_implementation.load(std::memory_order_acquire);
+  if (impl == nullptr) {
+    const kernel_implementation* detected = &detect_best_implementation();
+    if (active_implementation.compare_exchange_strong(impl, detected, std::memory_order_acq_rel)) {
+      impl = detected;
+    }
+  }
+  return *impl;
+}
+
+}  // namespace
+
+bool implementation::supported_by_runtime_system() const noexcept {
+  static const uint32_t supported_instruction_sets = internal::detect_supported_architectures();
+  return (required_instruction_sets_ & supported_instruction_sets) == required_instruction_sets_;
+}
+
+const implementation& get_active_implementation() {
+  return get_active_kernel_implementation();
+}
+
+std::span<const implementation* const> get_available_implementations() {
+  return available_implementations;
+}
+
+bool set_active_implementation(std::string_view name) {
+  const kernel_implementation* impl = find_supported_implementation(name);
+  if (impl == nullptr) {
+    return false;
+  }
+  active_implementation.store(impl, std::memory_order_release);
+  return true;
+}
+
+namespace scan {
+
+const kernels& active_kernels() {
+  return get_active_kernel_implementation().table();
+}
+
+const basic_kernels<char16_t>& utf16_kernels() {
+  return scalar::utf16_kernel_table;
+}
+
+}  // namespace scan
+
+}  // namespace lexer
@@ -0,0 +1,57 @@
+#ifndef MERVE_SCAN_H
+#define MERVE_SCAN_H
+
+#include <cstdint>
+
+namespace lexer::scan {
+
+// Scanning kernels used by the lexer's hot loops, one table per
+// implementation (see merve/implementation.h) and code unit type. Every
+// kernel works on the half-open range [p, end) and never reads outside of it.
+template <typename Char>
+struct basic_kernels {
+  // Returns a pointer to the first '\n' or '\r' in [p, end), or end.
+  const Char* (*find_line_terminator)(const Char* p, const Char* end);
+
+  // Returns a pointer to the '*' of the first "*/" in [p, end), or end.
+  const Char* (*find_block_comment_end)(const Char* p, const Char* end);
+
+  // Returns a pointer to the first `quote`, '\\', '\n' or '\r' in [p, end),
+  // or end: the only bytes a string literal body has to stop at.
+  const Char* (*find_quote_or_escape)(const Char* p, const Char* end, Char quote);
+
+  // Returns a pointer to the first '`' or "${" in [p, end) that is not
+  // escaped by a backslash, or end: the bytes that end a template literal
+  // chunk.
+  const Char* (*find_template_end)(const Char* p, const Char* end);
+
+  // Returns the number of line terminators in [p, end): every '\n', and
+  // every '\r' not followed by '\n', so CRLF counts once. A '\r' in the last
+  // byte counts, since the byte after it is outside the range.
+  uint32_t (*count_line_terminators)(const Char* p, const Char* end);
+
+  // Stage 1 of the two-stage scan: returns one bit per byte of
+  // [p, min(p + 64, end)) that the lexer's main loop has to stop at. Those
+  // are quotes, '/', '`', parentheses, braces, the first letter of every
+  // identifier starting with e, m, O, c, i, r or '_', and every "re". All
+  // other bytes are whitespace or only ever update lastTokenPos, so stage 2
+  // can jump over them. `prev` is the byte before p, or '\0' at the start of
+  // the input.
+  //
+  // Null for the scalar implementation and for UTF-16, where visiting every
+  // code unit is cheaper than building the masks.
+  uint64_t (*structural_block)(const Char* p, const Char* end, Char prev);
+};
+
+using kernels = basic_kernels<char>;
+
+// Kernels of the active implementation, selected on first use.
+const kernels& active_kernels();
+
+// Kernels for UTF-16 input. These are the scalar kernels: the vectorized
+// ones only exist for bytes.
+const basic_kernels<char16_t>& utf16_kernels();
+
+}  // namespace lexer::scan
+
+#endif  // MERVE_SCAN_H
@@ -0,0 +1,56 @@
+#ifndef MERVE_SIMD_AVX2_H
+#define MERVE_SIMD_AVX2_H
+
+// 64-byte blocks as two 256-bit AVX2 registers. Included by scan.cpp inside
+// the implementation's namespace and target region; generic/scan_kernels.h
+// builds the kernels on top of it.
+
+struct simd8x64 {
+  __m256i chunks[2];
+
+  static simd8x64 load(const char* p) {
+    return {{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+             _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32))}};
+  }
+
+  uint64_t eq(char c) const {
+    const __m256i needle = _mm256_set1_epi8(c);
+    uint64_t lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunks[0], needle)));
+    uint64_t hi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunks[1], needle)));
+    return lo | (hi << 32);
+  }
+
+  // Bytes equal to any of `cs`; cheaper than OR-ing eq() results.
+  template <typename... Chars>
+  uint64_t eq_any(Chars... cs) const {
+    uint64_t r[2];
+    for (int i = 0; i < 2; i++) {
+      __m256i match = _mm256_setzero_si256();
+      ((match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunks[i], _mm256_set1_epi8(cs)))), ...);
+      r[i] = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+    }
+    return r[0] | (r[1] << 32);
+  }
+
+  // Bytes in [lo, hi], compared as unsigned.
+  uint64_t in_range(char lo, char hi) const {
+    const __m256i low = _mm256_set1_epi8(lo);
+    const __m256i high = _mm256_set1_epi8(hi);
+    uint64_t r[2];
+    for (int i = 0; i < 2; i++) {
+      __m256i above = _mm256_cmpeq_epi8(_mm256_max_epu8(chunks[i], low), chunks[i]);
+      __m256i below = _mm256_cmpeq_epi8(_mm256_min_epu8(chunks[i], high), chunks[i]);
+      r[i] = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(above, below)));
+    }
+    return r[0] | (r[1] << 32);
+  }
+
+  // Bytes >= 0x80.
+  uint64_t high_bits() const {
+    uint64_t lo = static_cast<uint32_t>(_mm256_movemask_epi8(chunks[0]));
+    uint64_t hi = static_cast<uint32_t>(_mm256_movemask_epi8(chunks[1]));
+    return lo | (hi << 32);
+  }
+};
+
+#endif  // MERVE_SIMD_AVX2_H
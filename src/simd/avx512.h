@@ -0,0 +1,38 @@
+#ifndef MERVE_SIMD_AVX512_H
+#define MERVE_SIMD_AVX512_H
+
+// 64-byte blocks as one AVX-512 register; comparisons yield 64-bit masks
+// directly. Included by scan.cpp inside the implementation's namespace and
+// target region; generic/scan_kernels.h builds the kernels on top of it.
+
+struct simd8x64 {
+  __m512i chunk;
+
+  static simd8x64 load(const char* p) {
+    return {_mm512_loadu_si512(p)};
+  }
+
+  uint64_t eq(char c) const {
+    return _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(c));
+  }
+
+  // Bytes equal to any of `cs`. Comparisons produce masks directly, so
+  // there is nothing to gain from combining them in vector registers.
+  template <typename... Chars>
+  uint64_t eq_any(Chars... cs) const {
+    return (eq(cs) | ...);
+  }
+
+  // Bytes in [lo, hi], compared as unsigned.
+  uint64_t in_range(char lo, char hi) const {
+    return _mm512_cmpge_epu8_mask(chunk, _mm512_set1_epi8(lo)) &
+           _mm512_cmple_epu8_mask(chunk, _mm512_set1_epi8(hi));
+  }
+
+  // Bytes >= 0x80.
+  uint64_t high_bits() const {
+    return _mm512_movepi8_mask(chunk);
+  }
+};
+
+#endif  // MERVE_SIMD_AVX512_H
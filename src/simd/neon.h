@@ -0,0 +1,64 @@
+#ifndef MERVE_SIMD_NEON_H
+#define MERVE_SIMD_NEON_H
+
+// 64-byte blocks as four 128-bit NEON registers. Included by scan.cpp inside
+// the implementation's namespace; generic/scan_kernels.h builds the kernels
+// on top of it.
+
+struct simd8x64 {
+  uint8x16_t chunks[4];
+
+  static simd8x64 load(const char* p) {
+    const uint8_t* u = reinterpret_cast<const uint8_t*>(p);
+    return {{vld1q_u8(u), vld1q_u8(u + 16), vld1q_u8(u + 32), vld1q_u8(u + 48)}};
+  }
+
+  uint64_t eq(char c) const {
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+    return to_bitmask(vceqq_u8(chunks[0], needle), vceqq_u8(chunks[1], needle),
+                      vceqq_u8(chunks[2], needle), vceqq_u8(chunks[3], needle));
+  }
+
+  // Bytes equal to any of `cs`; cheaper than OR-ing eq() results.
+  template <typename... Chars>
+  uint64_t eq_any(Chars... cs) const {
+    uint8x16_t match[4];
+    for (int i = 0; i < 4; i++) {
+      match[i] = vdupq_n_u8(0);
+      ((match[i] = vorrq_u8(match[i], vceqq_u8(chunks[i], vdupq_n_u8(static_cast<uint8_t>(cs))))), ...);
+    }
+    return to_bitmask(match[0], match[1], match[2], match[3]);
+  }
+
+  // Bytes in [lo, hi], compared as unsigned.
+  uint64_t in_range(char lo, char hi) const {
+    const uint8x16_t low = vdupq_n_u8(static_cast<uint8_t>(lo));
+    const uint8x16_t high = vdupq_n_u8(static_cast<uint8_t>(hi));
+    return to_bitmask(vandq_u8(vcgeq_u8(chunks[0], low), vcleq_u8(chunks[0], high)),
+                      vandq_u8(vcgeq_u8(chunks[1], low), vcleq_u8(chunks[1], high)),
+                      vandq_u8(vcgeq_u8(chunks[2], low), vcleq_u8(chunks[2], high)),
+                      vandq_u8(vcgeq_u8(chunks[3], low), vcleq_u8(chunks[3], high)));
+  }
+
+  // Bytes >= 0x80.
+  uint64_t high_bits() const {
+    const uint8x16_t sign = vdupq_n_u8(0x80);
+    return to_bitmask(vcgeq_u8(chunks[0], sign), vcgeq_u8(chunks[1], sign),
+                      vcgeq_u8(chunks[2], sign), vcgeq_u8(chunks[3], sign));
+  }
+
+  // NEON has no movemask: keep one distinct bit per lane, then fold
+  // neighbouring lanes together with pairwise adds until 64 bits remain.
+  static uint64_t to_bitmask(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3) {
+    static const uint8_t kBits[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                      0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    const uint8x16_t bits = vld1q_u8(kBits);
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+  }
+};
+
+#endif  // MERVE_SIMD_NEON_H
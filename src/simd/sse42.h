@@ -0,0 +1,62 @@
+#ifndef MERVE_SIMD_SSE42_H
+#define MERVE_SIMD_SSE42_H
+
+// 64-byte blocks as four 128-bit SSE registers. Included by scan.cpp inside
+// the implementation's namespace and target region; generic/scan_kernels.h
+// builds the kernels on top of it.
+
+struct simd8x64 {
+  __m128i chunks[4];
+
+  static simd8x64 load(const char* p) {
+    return {{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+             _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)),
+             _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)),
+             _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48))}};
+  }
+
+  uint64_t eq(char c) const {
+    const __m128i needle = _mm_set1_epi8(c);
+    uint64_t r0 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[0], needle)));
+    uint64_t r1 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[1], needle)));
+    uint64_t r2 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[2], needle)));
+    uint64_t r3 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[3], needle)));
+    return r0 | (r1 << 16) | (r2 << 32) | (r3 << 48);
+  }
+
+  // Bytes equal to any of `cs`; cheaper than OR-ing eq() results.
+  template <typename... Chars>
+  uint64_t eq_any(Chars... cs) const {
+    uint64_t result = 0;
+    for (int i = 0; i < 4; i++) {
+      __m128i match = _mm_setzero_si128();
+      ((match = _mm_or_si128(match, _mm_cmpeq_epi8(chunks[i], _mm_set1_epi8(cs)))), ...);
+      result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(match))) << (16 * i);
+    }
+    return result;
+  }
+
+  // Bytes in [lo, hi], compared as unsigned.
+  uint64_t in_range(char lo, char hi) const {
+    const __m128i low = _mm_set1_epi8(lo);
+    const __m128i high = _mm_set1_epi8(hi);
+    uint64_t result = 0;
+    for (int i = 0; i < 4; i++) {
+      __m128i above = _mm_cmpeq_epi8(_mm_max_epu8(chunks[i], low), chunks[i]);
+      __m128i below = _mm_cmpeq_epi8(_mm_min_epu8(chunks[i], high), chunks[i]);
+      result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_and_si128(above, below)))) << (16 * i);
+    }
+    return result;
+  }
+
+  // Bytes >= 0x80.
+  uint64_t high_bits() const {
+    uint64_t result = 0;
+    for (int i = 0; i < 4; i++) {
+      result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(chunks[i]))) << (16 * i);
+    }
+    return result;
+  }
+};
+
+#endif  // MERVE_SIMD_SSE42_H
@@ -23,6 +23,23 @@ static void check_types(void) {
   merve_analysis a = (merve_analysis)0;
   (void)a;
 
+  merve_parser p = (merve_parser)0;
+  (void)p;
+
+  merve_export e;
+  e.name = s;
+  e.line = 1;
+  (void)e;
+
+  merve_result_info info;
+  info.error = -1;
+  info.error_offset = 0;
+  info.error_line = 0;
+  info.exports_count = 0;
+  info.reexports_count = 0;
+  info.string_length = 0;
+  (void)info;
+
   /* Verify the error constants are valid integer constant expressions. */
   int errors[] = {
       MERVE_ERROR_TODO,
@@ -38,6 +55,8 @@ static void check_types(void) {
       MERVE_ERROR_UNEXPECTED_ESM_IMPORT,
       MERVE_ERROR_UNEXPECTED_ESM_EXPORT,
       MERVE_ERROR_TEMPLATE_NEST_OVERFLOW,
+      MERVE_ERROR_INVALID_UTF8,
+      MERVE_ERROR_SOURCE_TOO_LARGE,
   };
   (void)errors;
 }
@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 
 // Helper: compare merve_string to a C string literal.
 static bool merve_string_eq(merve_string s, const char* expected) {
@@ -382,3 +384,319 @@ TEST(c_api_tests, spread_reexports) {
   ASSERT_TRUE(merve_string_eq(merve_get_reexport_name(result, 1), "dep2"));
   merve_free(result);
 }
+
+TEST(c_api_tests, reusable_parser) {
+  merve_parser parser = merve_parser_create();
+  ASSERT_NE(parser, nullptr);
+
+  const char* source1 = "exports.x = 1;\nmodule.exports = require('dep');";
+  merve_analysis r1 = merve_parser_parse(parser, source1, std::strlen(source1));
+  ASSERT_NE(r1, nullptr);
+  ASSERT_TRUE(merve_is_valid(r1));
+  ASSERT_EQ(merve_get_exports_count(r1), 1u);
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(r1, 0), "x"));
+  ASSERT_EQ(merve_get_reexports_count(r1), 1u);
+  ASSERT_EQ(merve_get_reexport_line(r1, 0), 2u);
+  // Parser-owned results are released by the parser, not merve_free().
+  merve_free(r1);
+
+  const char* source2 = "import 'x';";
+  merve_analysis r2 = merve_parser_parse(parser, source2, std::strlen(source2));
+  ASSERT_FALSE(merve_is_valid(r2));
+  ASSERT_EQ(merve_get_last_error(), MERVE_ERROR_UNEXPECTED_ESM_IMPORT);
+  ASSERT_EQ(merve_get_exports_count(r2), 0u);
+
+  merve_analysis r3 = merve_parser_parse(parser, nullptr, 0);
+  ASSERT_TRUE(merve_is_valid(r3));
+  ASSERT_EQ(merve_get_exports_count(r3), 0u);
+  ASSERT_EQ(merve_get_reexports_count(r3), 0u);
+  ASSERT_EQ(merve_get_last_error(), -1);
+
+  merve_parser_free(parser);
+}
+
+TEST(c_api_tests, reusable_parser_null_safety) {
+  ASSERT_EQ(merve_parser_parse(nullptr, "exports.x = 1;", 14), nullptr);
+  merve_parser_free(nullptr);
+}
+
+TEST(c_api_tests, parse_into_caller_buffers) {
+  const char* source =
+      "exports.a = 1;\nexports['\\u0062\\u0063'] = 2;\n"
+      "__exportStar(require('./\\u0064'));";
+  size_t length = std::strlen(source);
+  merve_export out[4];
+  char strings[16];
+  merve_result_info info;
+
+  ASSERT_TRUE(merve_parse_commonjs_into(source, length, out, 4, strings,
+                                        sizeof(strings), &info));
+  ASSERT_EQ(info.error, -1);
+  ASSERT_EQ(info.exports_count, 2u);
+  ASSERT_EQ(info.reexports_count, 1u);
+  ASSERT_EQ(info.string_length, 5u);
+  ASSERT_TRUE(merve_string_eq(out[0].name, "a"));
+  ASSERT_EQ(out[0].name.data, source + 8);
+  ASSERT_EQ(out[0].line, 1u);
+  ASSERT_TRUE(merve_string_eq(out[1].name, "bc"));
+  ASSERT_EQ(out[1].name.data, strings);
+  ASSERT_EQ(out[1].line, 2u);
+  ASSERT_TRUE(merve_string_eq(out[2].name, "./d"));
+  ASSERT_EQ(out[2].name.data, strings + 2);
+  ASSERT_EQ(out[2].line, 3u);
+}
+
+TEST(c_api_tests, parse_into_reports_required_sizes) {
+  const char* source = "exports.a = 1; exports['\\u0062'] = 2;";
+  size_t length = std::strlen(source);
+  merve_result_info info;
+
+  // Query the sizes first, then parse into buffers that fit.
+  ASSERT_FALSE(merve_parse_commonjs_into(source, length, nullptr, 0, nullptr,
+                                         0, &info));
+  ASSERT_EQ(info.error, -1);
+  ASSERT_EQ(info.exports_count, 2u);
+  ASSERT_EQ(info.reexports_count, 0u);
+  ASSERT_EQ(info.string_length, 1u);
+
+  merve_export out[2];
+  char strings[1];
+  ASSERT_FALSE(merve_parse_commonjs_into(source, length, out, 1, strings, 1,
+                                         &info));
+  ASSERT_FALSE(merve_parse_commonjs_into(source, length, out, 2, strings, 0,
+                                         &info));
+  ASSERT_TRUE(merve_parse_commonjs_into(source, length, out, 2, strings, 1,
+                                        nullptr));
+  ASSERT_TRUE(merve_string_eq(out[1].name, "b"));
+}
+
+TEST(c_api_tests, parse_into_errors) {
+  const char* source = "import x from 'y';";
+  merve_export out[1];
+  merve_result_info info;
+  ASSERT_FALSE(merve_parse_commonjs_into(source, std::strlen(source), out, 1,
+                                         nullptr, 0, &info));
+  ASSERT_EQ(info.error, MERVE_ERROR_UNEXPECTED_ESM_IMPORT);
+  ASSERT_EQ(info.exports_count, 0u);
+  ASSERT_EQ(merve_get_last_error(), MERVE_ERROR_UNEXPECTED_ESM_IMPORT);
+
+  ASSERT_TRUE(merve_parse_commonjs_into(nullptr, 0, nullptr, 0, nullptr, 0,
+                                        &info));
+  ASSERT_EQ(info.error, -1);
+  ASSERT_EQ(info.exports_count, 0u);
+}
+
+TEST(c_api_tests, bulk_accessors) {
+  const char* source =
+      "exports.a = 1;\nexports['\\u0062'] = 2;\nexports.c = 3;\n"
+      "__exportStar(require('./d'));";
+  merve_analysis result = merve_parse_commonjs(source, std::strlen(source));
+  ASSERT_TRUE(merve_is_valid(result));
+
+  merve_string names[4];
+  uint32_t lines[4];
+  ASSERT_EQ(merve_get_exports(result, 0, names, lines, 4), 3u);
+  for (size_t i = 0; i < 3; i++) {
+    merve_string name = merve_get_export_name(result, i);
+    ASSERT_EQ(names[i].data, name.data);
+    ASSERT_EQ(names[i].length, name.length);
+    ASSERT_EQ(lines[i], merve_get_export_line(result, i));
+  }
+
+  // Paging through with a smaller buffer, and skipping lines.
+  ASSERT_EQ(merve_get_exports(result, 1, names, nullptr, 1), 1u);
+  ASSERT_TRUE(merve_string_eq(names[0], "b"));
+  ASSERT_EQ(merve_get_exports(result, 2, nullptr, lines, 4), 1u);
+  ASSERT_EQ(lines[0], 3u);
+  ASSERT_EQ(merve_get_exports(result, 3, names, lines, 4), 0u);
+
+  ASSERT_EQ(merve_get_reexports(result, 0, names, lines, 4), 1u);
+  ASSERT_TRUE(merve_string_eq(names[0], "./d"));
+  ASSERT_EQ(lines[0], 4u);
+  merve_free(result);
+
+  ASSERT_EQ(merve_get_exports(nullptr, 0, names, lines, 4), 0u);
+  ASSERT_EQ(merve_get_reexports(nullptr, 0, names, lines, 4), 0u);
+  const char* esm = "export default 1;";
+  result = merve_parse_commonjs(esm, std::strlen(esm));
+  ASSERT_EQ(merve_get_exports(result, 0, names, lines, 4), 0u);
+  merve_free(result);
+}
+
+TEST(c_api_tests, error_travels_with_result) {
+  const char* esm = "export default 1;";
+  const char* unclosed = "exports.a = {";
+  const char* valid = "exports.a = 1;";
+  merve_analysis failed = merve_parse_commonjs(esm, std::strlen(esm));
+  merve_analysis unterminated =
+      merve_parse_commonjs(unclosed, std::strlen(unclosed));
+  merve_analysis ok = merve_parse_commonjs(valid, std::strlen(valid));
+  ASSERT_EQ(merve_get_last_error(), -1);
+  ASSERT_EQ(merve_get_error(failed), MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(merve_get_error(unterminated), MERVE_ERROR_UNTERMINATED_BRACE);
+  ASSERT_EQ(merve_get_error(ok), -1);
+  ASSERT_EQ(merve_get_error(nullptr), -1);
+  merve_free(failed);
+  merve_free(unterminated);
+  merve_free(ok);
+
+  merve_parser parser = merve_parser_create();
+  merve_analysis result = merve_parser_parse(parser, esm, std::strlen(esm));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  result = merve_parser_parse(parser, valid, std::strlen(valid));
+  ASSERT_EQ(merve_get_error(result), -1);
+  merve_parser_free(parser);
+}
+
+TEST(c_api_tests, error_location) {
+  const char* esm = "exports.a = 1;\nexport default 1;";
+  merve_analysis result = merve_parse_commonjs(esm, std::strlen(esm));
+  ASSERT_EQ(merve_get_error_offset(result), 15u);
+  ASSERT_EQ(merve_get_error_line(result), 2u);
+  merve_free(result);
+  ASSERT_EQ(merve_get_error_offset(nullptr), 0u);
+  ASSERT_EQ(merve_get_error_line(nullptr), 0u);
+
+  merve_parser parser = merve_parser_create();
+  const char* unclosed = "f(\n";
+  result = merve_parser_parse(parser, unclosed, std::strlen(unclosed));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_UNTERMINATED_PAREN);
+  ASSERT_EQ(merve_get_error_offset(result), 3u);
+  ASSERT_EQ(merve_get_error_line(result), 2u);
+  result = merve_parser_parse(parser, "exports.a = 1;", 14);
+  ASSERT_EQ(merve_get_error_offset(result), 0u);
+  ASSERT_EQ(merve_get_error_line(result), 0u);
+  merve_parser_free(parser);
+
+  merve_result_info info{};
+  ASSERT_FALSE(merve_parse_commonjs_into(esm, std::strlen(esm), nullptr, 0,
+                                         nullptr, 0, &info));
+  ASSERT_EQ(info.error, MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(info.error_offset, 15u);
+  ASSERT_EQ(info.error_line, 2u);
+}
+
+TEST(c_api_tests, parse_commonjs_file) {
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "merve_c_parse_commonjs_file.js";
+  std::ofstream(path, std::ios::binary) << "exports.a = 1;\nexport default 2;";
+  std::string utf8 = path.string();
+
+  merve_analysis result = merve_parse_commonjs_file(utf8.c_str());
+  ASSERT_NE(result, nullptr);
+  ASSERT_FALSE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(merve_get_error_line(result), 2u);
+  merve_free(result);
+
+  std::ofstream(path, std::ios::binary) << "exports.a = 1;\nexports.b = 2;";
+  result = merve_parse_commonjs_file(utf8.c_str());
+  ASSERT_TRUE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_exports_count(result), 2u);
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(result, 1), "b"));
+  ASSERT_EQ(merve_get_export_line(result, 1), 2u);
+  merve_free(result);
+
+  std::filesystem::remove(path);
+  ASSERT_EQ(merve_parse_commonjs_file(utf8.c_str()), nullptr);
+  ASSERT_EQ(merve_parse_commonjs_file(nullptr), nullptr);
+}
+
+TEST(c_api_tests, parse_commonjs_shared) {
+  struct buffer {
+    char* data;
+    int releases;
+  };
+  auto release = [](void* context) {
+    buffer* b = static_cast<buffer*>(context);
+    delete[] b->data;
+    b->data = nullptr;
+    b->releases++;
+  };
+  const char* source = "exports.a = 1;\nexports.b = 2;";
+  size_t length = std::strlen(source);
+  buffer b{new char[length], 0};
+  std::memcpy(b.data, source, length);
+
+  merve_analysis result = merve_parse_commonjs_shared(b.data, length, release, &b);
+  ASSERT_TRUE(merve_is_valid(result));
+  ASSERT_EQ(b.releases, 0);
+  ASSERT_EQ(merve_get_exports_count(result), 2u);
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(result, 1), "b"));
+  ASSERT_EQ(merve_get_export_line(result, 1), 2u);
+  merve_free(result);
+  ASSERT_EQ(b.releases, 1);
+
+  // Released right away when the result does not refer to the source.
+  const char* esm = "export default 1;";
+  b.data = new char[std::strlen(esm)];
+  std::memcpy(b.data, esm, std::strlen(esm));
+  result = merve_parse_commonjs_shared(b.data, std::strlen(esm), release, &b);
+  ASSERT_FALSE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(b.releases, 2);
+  merve_free(result);
+  ASSERT_EQ(b.releases, 2);
+
+  for (size_t length : {0, 5}) {
+    result = merve_parse_commonjs_shared(nullptr, length, nullptr, nullptr);
+    ASSERT_TRUE(merve_is_valid(result));
+    ASSERT_EQ(merve_get_exports_count(result), 0u);
+    merve_free(result);
+  }
+}
+
+TEST(c_api_tests, parse_commonjs_utf16) {
+  std::u16string source = u"exports.café = 1;\nmodule.exports = require('./b');";
+  merve_analysis result = merve_parse_commonjs_utf16(
+      reinterpret_cast<const uint16_t*>(source.data()), source.size());
+  source.assign(source.size(), u'x');  // The names do not refer to the source.
+  ASSERT_TRUE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_exports_count(result), 1u);
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(result, 0), "caf\xc3\xa9"));
+  ASSERT_EQ(merve_get_reexports_count(result), 1u);
+  ASSERT_TRUE(merve_string_eq(merve_get_reexport_name(result, 0), "./b"));
+  ASSERT_EQ(merve_get_reexport_line(result, 0), 2u);
+  merve_free(result);
+
+  std::u16string esm = u"const é = 1;\nexport default 1;";
+  result = merve_parse_commonjs_utf16(
+      reinterpret_cast<const uint16_t*>(esm.data()), esm.size());
+  ASSERT_FALSE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(merve_get_error_offset(result), 13u);
+  merve_free(result);
+
+  // NULL is lexed as an empty source, whatever the length.
+  for (size_t length : {0, 5}) {
+    result = merve_parse_commonjs_utf16(nullptr, length);
+    ASSERT_TRUE(merve_is_valid(result));
+    ASSERT_EQ(merve_get_exports_count(result), 0u);
+    merve_free(result);
+  }
+}
+
+TEST(c_api_tests, parse_commonjs_latin1) {
+  const char* source = "exports.caf\xe9 = 1;\xa0" "exports.b = 2;";
+  merve_analysis result = merve_parse_commonjs_latin1(source, std::strlen(source));
+  ASSERT_TRUE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_exports_count(result), 2u);
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(result, 0), "caf\xc3\xa9"));
+  ASSERT_TRUE(merve_string_eq(merve_get_export_name(result, 1), "b"));
+  merve_free(result);
+}
+
+TEST(c_api_tests, parse_commonjs_validated) {
+  const char* source = "exports.a = 1;\n'\xff';";
+  merve_analysis result = merve_parse_commonjs_validated(source, std::strlen(source));
+  ASSERT_FALSE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_error(result), MERVE_ERROR_INVALID_UTF8);
+  ASSERT_EQ(merve_get_error_offset(result), 16u);
+  ASSERT_EQ(merve_get_error_line(result), 2u);
+  merve_free(result);
+
+  result = merve_parse_commonjs_validated(source, 14);
+  ASSERT_TRUE(merve_is_valid(result));
+  ASSERT_EQ(merve_get_exports_count(result), 1u);
+  merve_free(result);
+}
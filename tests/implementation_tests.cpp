@@ -0,0 +1,119 @@
+#include "merve.h"
+
+#include "gtest/gtest.h"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Restores the implementation that was active when the test started.
+class implementation_tests : public ::testing::Test {
+ protected:
+  void SetUp() override { original = std::string(lexer::get_active_implementation().name()); }
+  void TearDown() override { ASSERT_TRUE(lexer::set_active_implementation(original)); }
+
+ private:
+  std::string original;
+};
+
+// Inputs whose comments, strings and templates straddle 64-byte block
+// boundaries at every offset, so the vectorized kernels and their scalar
+// tails are both exercised.
+std::vector<std::string> boundary_inputs() {
+  std::vector<std::string> inputs;
+  for (size_t len = 0; len < 150; ++len) {
+    std::string filler(len, 'x');
+    inputs.push_back("// " + filler + "\r\n/* " + filler + "\r\n*" + filler + "\r*/\n"
+                     "var s = '" + filler + "\\\r\n\\'" + filler + "', t = \"" + filler + "\";\n"
+                     "var u = `" + filler + "\n${ `" + filler + "$x{` }\\`" + filler + "`;\n"
+                     "exports.a" + std::to_string(len) + " = require('./" + filler + "');\n");
+    inputs.push_back("var s = '" + filler + "\n';");
+    inputs.push_back("/* " + filler);
+    inputs.push_back("var t = `" + filler + "\\");
+  }
+  std::string large;
+  while (large.size() < 16 * 1024) {
+    large += inputs[large.size() % inputs.size()];
+  }
+  inputs.push_back(large);
+  return inputs;
+}
+
+struct outcome {
+  std::vector<std::string> exports;
+  std::vector<uint32_t> lines;
+  std::vector<std::string> re_exports;
+  std::optional<lexer::lexer_error> error;
+
+  bool operator==(const outcome&) const = default;
+};
+
+outcome parse(const std::string& input) {
+  outcome result;
+  auto analysis = lexer::parse_commonjs(input);
+  result.error = lexer::get_last_error();
+  if (analysis) {
+    for (const auto& e : analysis->exports) {
+      result.exports.emplace_back(lexer::get_string_view(e));
+      result.lines.push_back(e.line);
+    }
+    for (const auto& e : analysis->re_exports) {
+      result.re_exports.emplace_back(lexer::get_string_view(e));
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_F(implementation_tests, available_implementations) {
+  auto available = lexer::get_available_implementations();
+  ASSERT_FALSE(available.empty());
+  ASSERT_EQ(available.back()->name(), "scalar");
+  ASSERT_TRUE(available.back()->supported_by_runtime_system());
+  for (const lexer::implementation* impl : available) {
+    ASSERT_FALSE(impl->name().empty());
+    ASSERT_FALSE(impl->description().empty());
+  }
+}
+
+TEST_F(implementation_tests, active_implementation_is_supported) {
+  const lexer::implementation& active = lexer::get_active_implementation();
+  ASSERT_TRUE(active.supported_by_runtime_system());
+  bool listed = false;
+  for (const lexer::implementation* impl : lexer::get_available_implementations()) {
+    listed = listed || impl == &active;
+  }
+  ASSERT_TRUE(listed);
+}
+
+TEST_F(implementation_tests, set_active_implementation) {
+  ASSERT_FALSE(lexer::set_active_implementation("no-such-implementation"));
+  ASSERT_TRUE(lexer::set_active_implementation("scalar"));
+  ASSERT_EQ(lexer::get_active_implementation().name(), "scalar");
+  for (const lexer::implementation* impl : lexer::get_available_implementations()) {
+    ASSERT_EQ(lexer::set_active_implementation(impl->name()), impl->supported_by_runtime_system());
+    if (impl->supported_by_runtime_system()) {
+      ASSERT_EQ(&lexer::get_active_implementation(), impl);
+    }
+  }
+}
+
+TEST_F(implementation_tests, implementations_agree) {
+  std::vector<std::string> inputs = boundary_inputs();
+  ASSERT_TRUE(lexer::set_active_implementation("scalar"));
+  std::vector<outcome> expected;
+  for (const auto& input : inputs) {
+    expected.push_back(parse(input));
+  }
+  for (const lexer::implementation* impl : lexer::get_available_implementations()) {
+    if (!impl->supported_by_runtime_system()) {
+      continue;
+    }
+    ASSERT_TRUE(lexer::set_active_implementation(impl->name()));
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      ASSERT_TRUE(parse(inputs[i]) == expected[i]) << impl->name() << " differs on input " << i;
+    }
+  }
+}
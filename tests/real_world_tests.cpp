@@ -1,5 +1,15 @@
 #include "merve.h"
 #include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 TEST(real_world_tests, esbuild_hint_style) {
   auto result = lexer::parse_commonjs("0 && (module.exports = {a, b, c}) && __exportStar(require('fs'));");
@@ -1209,3 +1219,985 @@ TEST(real_world_tests, line_numbers_after_block_comment) {
   ASSERT_EQ(lexer::get_string_view(result->exports[0]), "after_comment");
   ASSERT_EQ(result->exports[0].line, 5);
 }
+
+TEST(real_world_tests, line_numbers_after_shebang) {
+  auto result = lexer::parse_commonjs(
+    "#!/usr/bin/env node\n"
+    "exports.a = 1;\n"
+  );
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(result->exports[0].line, 2);
+}
+
+TEST(real_world_tests, line_numbers_many_exports) {
+  // Mixed terminators between every export, with CRLF pairs landing on both
+  // sides of the 64-byte block boundaries.
+  const char* terminators[] = {"\n", "\r\n", "\r", "\n\r", "\r\r\n"};
+  std::string source;
+  std::vector<uint32_t> expected;
+  uint32_t line = 1;
+  for (size_t i = 0; i < 300; ++i) {
+    const char* terminator = terminators[i % 5];
+    source += std::string(i % 7, ' ') + "exports.e" + std::to_string(i) + " = 1;" + terminator;
+    expected.push_back(line);
+    line += (i % 5 == 3 || i % 5 == 4) ? 2 : 1;
+    if (i % 11 == 0) {
+      source += "__exportStar(require('./d" + std::to_string(i) + "'));\r\n";
+      line++;
+    }
+  }
+  auto result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(result->exports[i].line, expected[i]) << i;
+  }
+  ASSERT_EQ(result->re_exports.size(), 28);
+  for (size_t i = 0; i < result->re_exports.size(); ++i) {
+    ASSERT_EQ(result->re_exports[i].line, expected[i * 11] + (i * 11 % 5 >= 3 ? 2 : 1)) << i;
+  }
+}
+
+TEST(real_world_tests, long_line_comments) {
+  // Terminators at every offset around the 64-byte block boundaries.
+  for (size_t len = 0; len < 200; ++len) {
+    for (const char* terminator : {"\n", "\r", "\r\n"}) {
+      std::string source = "exports.a = 1;//" + std::string(len, 'x') + terminator + "exports.b = 2;";
+      auto result = lexer::parse_commonjs(source);
+      ASSERT_TRUE(result.has_value());
+      ASSERT_EQ(result->exports.size(), 2);
+      ASSERT_EQ(lexer::get_string_view(result->exports[1]), "b");
+      ASSERT_EQ(result->exports[1].line, 2);
+    }
+  }
+}
+
+TEST(real_world_tests, source_mapping_url_comment) {
+  std::string source = "exports.a = 1;\n//# sourceMappingURL=data:application/json;base64,";
+  source.append(1 << 20, 'A');
+  auto result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+
+  source += "\nexports.b = 2;";
+  result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 2);
+  ASSERT_EQ(result->exports[1].line, 3);
+}
+
+TEST(real_world_tests, long_block_comments) {
+  // Mixed LF / CR / CRLF bodies ending at every offset around the 64-byte
+  // block boundaries, including a CR split from its LF by a boundary.
+  const std::string pattern = "ab\ncd\r\nef\rgh*i/j\r\r\n";
+  for (size_t len = 0; len < 200; ++len) {
+    std::string body;
+    while (body.size() < len) body += pattern;
+    body.resize(len);
+    uint32_t lines = 1;
+    for (size_t i = 0; i < body.size(); ++i) {
+      lines += body[i] == '\n' || (body[i] == '\r' && (i + 1 == body.size() || body[i + 1] != '\n'));
+    }
+    std::string source = "/*" + body + "*/exports.a = 1;";
+    auto result = lexer::parse_commonjs(source);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->exports.size(), 1);
+    ASSERT_EQ(result->exports[0].line, lines);
+  }
+}
+
+TEST(real_world_tests, unterminated_block_comment) {
+  std::string source = "exports.a = 1;\n/*" + std::string(300, '\n') + "exports.b = 2;";
+  auto result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "a");
+}
+
+TEST(real_world_tests, long_string_literals) {
+  for (size_t len = 0; len < 200; ++len) {
+    std::string filler(len, 'x');
+    // Exports point into the source, so it must outlive the result.
+    std::string source =
+        "var css = '" + filler + "';\n"
+        "exports['" + filler + "'] = \"" + filler + "\\\"\\'" + filler + "\";\n"
+        "exports.b = 1;";
+    auto result = lexer::parse_commonjs(source);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->exports.size(), 2);
+    ASSERT_EQ(lexer::get_string_view(result->exports[0]), filler);
+    ASSERT_EQ(result->exports[1].line, 3);
+  }
+}
+
+TEST(real_world_tests, string_literal_escaped_newlines) {
+  std::string filler(100, 'x');
+  auto result = lexer::parse_commonjs(
+      "var s = '" + filler + "\\\n" + filler + "\\\r\n" + filler + "\\\r" + filler + "';\n"
+      "exports.a = 1;");
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(result->exports[0].line, 5);
+}
+
+TEST(real_world_tests, unterminated_long_string_literal) {
+  std::string filler(100, 'x');
+  for (const std::string& source : {"var s = '" + filler, "var s = '" + filler + "\n';",
+                                    "var s = '" + filler + "\\"}) {
+    auto result = lexer::parse_commonjs(source);
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNTERMINATED_STRING_LITERAL);
+  }
+}
+
+TEST(real_world_tests, long_template_literals) {
+  for (size_t len = 0; len < 200; ++len) {
+    std::string filler(len, 'x');
+    auto result = lexer::parse_commonjs(
+        "var css = `" + filler + "\n" + filler + "$x" + filler + "{`;\n"
+        "var q = `" + filler + "${ `" + filler + "${a}\r\n" + filler + "` }\\`" + filler + "`;\n"
+        "exports.b = 1;");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->exports.size(), 1);
+    ASSERT_EQ(result->exports[0].line, 5);
+  }
+}
+
+TEST(real_world_tests, template_literal_escaped_newlines) {
+  std::string filler(100, 'x');
+  auto result = lexer::parse_commonjs(
+      "var s = `" + filler + "\\\n" + filler + "\\\r\n" + filler + "\\\r" + filler + "\\${" + filler + "`;\n"
+      "exports.a = 1;");
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(result->exports[0].line, 5);
+}
+
+TEST(real_world_tests, unterminated_long_template_literal) {
+  std::string filler(100, 'x');
+  for (const std::string& source : {"var s = `" + filler, "var s = `" + filler + "\\`",
+                                    "var s = `" + filler + "\\", "var s = `" + filler + "$"}) {
+    auto result = lexer::parse_commonjs(source);
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNTERMINATED_TEMPLATE_STRING);
+  }
+}
+
+TEST(real_world_tests, large_input_matches_small_inputs) {
+  // In builds with MERVE_STRUCTURAL_INDEX=ON (off by default, see the CI
+  // matrix), large inputs go through the structural index; every chunk on
+  // its own is small enough to be lexed byte by byte, so both paths must
+  // agree. Other builds lex both byte by byte.
+  auto chunk = [](size_t i) {
+    std::string n = std::to_string(i);
+    return "// chunk " + n + " \xC3\xA9\r\n"
+           "var x" + n + " = a / 2 / b, re" + n + " = /[/]\\//g.test(s) ? 1 : 0;\r\n"
+           "function f" + n + "() { return /x/.source; }\n"
+           "var \xC3\xA9xports = 1, xrequire = 2, _interopRequireWildcard" + n + " = 3;\n"
+           "if (a) b = c\t/ d;\n"
+           "exports.e" + n + " = `" + n + " ${ { a: '}' }.a } \\` `;\n"
+           "module.exports.m" + n + " = require('./m" + n + "');\n"
+           "Object.defineProperty(exports, 'd" + n + "', { enumerable: true, get: function () { return q; } });\n"
+           "/* exports.hidden" + n + " = 1 */\r"
+           "__exportStar(require('./s" + n + "'), exports);\n";
+  };
+  std::string source;
+  std::vector<std::string> names;
+  std::vector<std::string> reexports;
+  uint32_t line_offset = 0;
+  std::vector<uint32_t> lines;
+  for (size_t i = 0; source.size() < 256 * 1024; ++i) {
+    std::string c = chunk(i);
+    auto small = lexer::parse_commonjs(c);
+    ASSERT_TRUE(small.has_value());
+    for (const auto& e : small->exports) {
+      names.emplace_back(lexer::get_string_view(e));
+      lines.push_back(e.line + line_offset);
+    }
+    for (const auto& e : small->re_exports) {
+      reexports.emplace_back(lexer::get_string_view(e));
+    }
+    line_offset += 10;
+    source += c;
+  }
+  auto large = lexer::parse_commonjs(source);
+  ASSERT_TRUE(large.has_value());
+  ASSERT_EQ(large->exports.size(), names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    ASSERT_EQ(lexer::get_string_view(large->exports[i]), names[i]);
+    ASSERT_EQ(large->exports[i].line, lines[i]);
+  }
+  ASSERT_EQ(large->re_exports.size(), reexports.size());
+  for (size_t i = 0; i < reexports.size(); ++i) {
+    ASSERT_EQ(lexer::get_string_view(large->re_exports[i]), reexports[i]);
+  }
+}
+
+TEST(real_world_tests, large_input_errors) {
+  std::string filler;
+  while (filler.size() < 128 * 1024) {
+    filler += "var a = b / c; exports.x = `y`;\n";
+  }
+  auto result = lexer::parse_commonjs(filler + "var s = 'unterminated\n");
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNTERMINATED_STRING_LITERAL);
+  result = lexer::parse_commonjs(filler + "}");
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_BRACE);
+  result = lexer::parse_commonjs(filler + "import('x'); import x from 'x';");
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+}
+
+TEST(real_world_tests, reusable_parser_matches_parse_commonjs) {
+  std::vector<std::string> sources = {
+      "exports.a = 1;\nmodule.exports.b = require('./b');",
+      "class A { m() { return `${ { x: `${(1)}` }.x }`; } }\nexports.c = /x/;",
+      "import 'x';",
+      "`${a)/b/`",
+      "(}",
+      "var a = (`${ ( } `, b); exports.d = 1;",
+      "Object.defineProperty(exports, 'e', { enumerable: true, value: 1 });\n"
+      "__exportStar(require('./f'));",
+      "",
+  };
+  lexer::parser parser;
+  // Parse everything twice so each source also runs on stacks left behind
+  // by every other one.
+  for (int round = 0; round < 2; ++round) {
+    for (const auto& source : sources) {
+      auto expected = lexer::parse_commonjs(source);
+      auto expected_error = lexer::get_last_error();
+      const lexer::lexer_analysis* result = parser.parse(source);
+      ASSERT_EQ(result != nullptr, expected.has_value()) << source;
+      ASSERT_EQ(lexer::get_last_error(), expected_error) << source;
+      if (!result) {
+        continue;
+      }
+      ASSERT_EQ(result->exports.size(), expected->exports.size()) << source;
+      for (size_t i = 0; i < result->exports.size(); ++i) {
+        ASSERT_EQ(lexer::get_string_view(result->exports[i]), lexer::get_string_view(expected->exports[i]));
+        ASSERT_EQ(result->exports[i].line, expected->exports[i].line);
+      }
+      ASSERT_EQ(result->re_exports.size(), expected->re_exports.size()) << source;
+      for (size_t i = 0; i < result->re_exports.size(); ++i) {
+        ASSERT_EQ(lexer::get_string_view(result->re_exports[i]), lexer::get_string_view(expected->re_exports[i]));
+        ASSERT_EQ(result->re_exports[i].line, expected->re_exports[i].line);
+      }
+    }
+  }
+
+  // A '/' right after a ')' or '}' that was consumed without closing anything
+  // must not see the deeper nesting the previous source left in the same
+  // buffer: require('a') is followed by a division, { a } by a regex.
+  std::string buffer;
+  buffer.reserve(64);
+  const char* pairs[][2] = {
+      {"if ((x));", "if;require('a') / exports.b = 1 / 2;"},
+      {"a = { b: (c) };", "module.exports = { a } / exports.b = 1 / 2;"},
+  };
+  for (const auto& [previous, source] : pairs) {
+    buffer = previous;
+    ASSERT_NE(parser.parse(buffer), nullptr);
+    buffer = source;
+    auto expected = lexer::parse_commonjs(buffer);
+    const lexer::lexer_analysis* result = parser.parse(buffer);
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->exports.size(), 1) << source;
+    ASSERT_EQ(lexer::get_string_view(result->exports[0]), lexer::get_string_view(expected->exports[0])) << source;
+  }
+}
+
+TEST(real_world_tests, reusable_parser_errors_reset) {
+  lexer::parser parser;
+  ASSERT_EQ(parser.parse("import x from 'x';"), nullptr);
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+  const lexer::lexer_analysis* result = parser.parse("exports.a = 1;");
+  ASSERT_NE(result, nullptr);
+  ASSERT_FALSE(lexer::get_last_error().has_value());
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "a");
+}
+
+TEST(real_world_tests, reusable_parser_move) {
+  lexer::parser first;
+  ASSERT_NE(first.parse("exports.a = 1;"), nullptr);
+  lexer::parser second(std::move(first));
+  const lexer::lexer_analysis* result = second.parse("exports.b = 1; exports.c = 2;");
+  ASSERT_NE(result, nullptr);
+  ASSERT_EQ(result->exports.size(), 2);
+  // A moved-from parser starts over on its next parse.
+  result = first.parse("exports.d = 1;");
+  ASSERT_NE(result, nullptr);
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "d");
+}
+
+TEST(real_world_tests, template_substitution_closed_by_paren) {
+  auto result = lexer::parse_commonjs("`${a)/b/`");
+  ASSERT_FALSE(result.has_value());
+  result = lexer::parse_commonjs("var x = `${a)/b/}`; exports.a = 1;");
+  ASSERT_FALSE(result.has_value());
+}
+
+TEST(real_world_tests, many_exports_deduplicated) {
+  // Enough exports to switch from the linear scan to the hash set, with
+  // duplicates both before and after the switch; the first one wins.
+  std::string source;
+  for (int i = 0; i < 1000; ++i) {
+    source += "exports.e" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+    source += "exports.e" + std::to_string(i / 2) + " = 0;\n";
+  }
+  source += "exports['\\u0065\\u0031'] = 1;\nexports.tail = 1;\n";
+  auto result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 1001);
+  for (size_t i = 0; i < 1000; ++i) {
+    ASSERT_EQ(lexer::get_string_view(result->exports[i]), "e" + std::to_string(i));
+    ASSERT_EQ(result->exports[i].line, 2 * i + 1);
+  }
+  ASSERT_EQ(lexer::get_string_view(result->exports[1000]), "tail");
+
+  // A reused parser starts from an empty set.
+  lexer::parser parser;
+  ASSERT_NE(parser.parse(source), nullptr);
+  const lexer::lexer_analysis* reused = parser.parse("exports.e0 = 1; exports.e999 = 2; exports.e0 = 3;");
+  ASSERT_NE(reused, nullptr);
+  ASSERT_EQ(reused->exports.size(), 2);
+  ASSERT_EQ(lexer::get_string_view(reused->exports[1]), "e999");
+}
+
+TEST(real_world_tests, compact_analysis_matches_parse_commonjs) {
+  std::string source =
+      "exports.a = 1;\n"
+      "exports['\\u0062'] = 2;\n"
+      "module.exports.c = 3;\n"
+      "Object.defineProperty(exports, '\\u{1F600}', { enumerable: true, value: 4 });\n"
+      "__exportStar(require('./d'));\n"
+      "__exportStar(require('./\\u0065'));\n";
+  auto expected = lexer::parse_commonjs(source);
+  ASSERT_TRUE(expected.has_value());
+  auto compact = lexer::parse_commonjs_compact(source);
+  ASSERT_TRUE(compact.has_value());
+  static_assert(sizeof(lexer::compact_export) == 16);
+
+  // Names must survive moving the result, whether they live in the source
+  // or in the arena.
+  lexer::compact_analysis moved = std::move(*compact);
+  ASSERT_EQ(moved.exports().size(), expected->exports.size());
+  for (size_t i = 0; i < expected->exports.size(); ++i) {
+    ASSERT_EQ(moved.name(moved.exports()[i]), lexer::get_string_view(expected->exports[i]));
+    ASSERT_EQ(moved.exports()[i].line, expected->exports[i].line);
+  }
+  ASSERT_EQ(moved.re_exports().size(), expected->re_exports.size());
+  for (size_t i = 0; i < expected->re_exports.size(); ++i) {
+    ASSERT_EQ(moved.name(moved.re_exports()[i]), lexer::get_string_view(expected->re_exports[i]));
+    ASSERT_EQ(moved.re_exports()[i].line, expected->re_exports[i].line);
+  }
+  ASSERT_EQ(moved.exports()[0].flags, 0u);
+  ASSERT_EQ(moved.exports()[1].flags, lexer::compact_export::in_arena);
+  ASSERT_EQ(moved.re_exports()[1].flags, lexer::compact_export::in_arena);
+
+  ASSERT_FALSE(lexer::parse_commonjs_compact("import 'x';").has_value());
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+}
+
+TEST(real_world_tests, reusable_parser_compact) {
+  lexer::parser parser;
+  std::string first = "exports.a = 1; exports['\\u0062'] = 2;";
+  std::string second = "exports.c = 3;";
+  auto a = parser.parse_compact(first);
+  auto b = parser.parse_compact(second);
+  ASSERT_TRUE(a.has_value());
+  ASSERT_TRUE(b.has_value());
+  // Compact results do not depend on the parser's memory.
+  ASSERT_EQ(a->exports().size(), 2);
+  ASSERT_EQ(a->name(a->exports()[0]), "a");
+  ASSERT_EQ(a->name(a->exports()[1]), "b");
+  ASSERT_EQ(b->exports().size(), 1);
+  ASSERT_EQ(b->name(b->exports()[0]), "c");
+  ASSERT_TRUE(b->re_exports().empty());
+  ASSERT_FALSE(parser.parse_compact("export default 1;").has_value());
+}
+
+TEST(real_world_tests, pmr_parse_commonjs) {
+  std::string source =
+      "exports.a = 1;\n"
+      "exports['\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062\\u0062"
+      "\\u0062\\u0062\\u0062\\u0062\\u0062'] = 2;\n"
+      "__exportStar(require('./\\u0063'));\n";
+  auto expected = lexer::parse_commonjs(source);
+  ASSERT_TRUE(expected.has_value());
+
+  // Everything must come from the buffer: the upstream throws.
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  auto result = lexer::parse_commonjs(source, &arena);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.get_allocator().resource(), &arena);
+  ASSERT_EQ(result->exports.size(), expected->exports.size());
+  for (size_t i = 0; i < expected->exports.size(); ++i) {
+    ASSERT_EQ(lexer::get_string_view(result->exports[i]), lexer::get_string_view(expected->exports[i]));
+    ASSERT_EQ(result->exports[i].line, expected->exports[i].line);
+  }
+  ASSERT_EQ(result->re_exports.size(), expected->re_exports.size());
+  ASSERT_EQ(lexer::get_string_view(result->re_exports[0]), "./c");
+  ASSERT_EQ(result->re_exports[0].line, 3);
+
+  // The long unescaped name does not fit in the small string buffer.
+  std::string_view name = lexer::get_string_view(result->exports[1]);
+  ASSERT_EQ(name, std::string(20, 'b'));
+  ASSERT_TRUE(name.data() >= buffer && name.data() < buffer + sizeof(buffer));
+
+  ASSERT_FALSE(lexer::parse_commonjs("import 'x';", &arena).has_value());
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+}
+
+TEST(real_world_tests, parse_commonjs_batch) {
+  std::vector<std::string> sources;
+  for (int i = 0; i < 200; ++i) {
+    std::string n = std::to_string(i);
+    if (i % 7 == 3) {
+      sources.push_back("import x from './" + n + "';");
+    } else if (i % 50 == 0) {
+      // A few large inputs, so that workers have to steal.
+      std::string large;
+      for (int j = 0; j < 2000; ++j) {
+        large += "exports.e" + std::to_string(j) + " = `" + n + "`;\n";
+      }
+      sources.push_back(large);
+    } else {
+      sources.push_back("exports.a" + n + " = 1;\n__exportStar(require('./" + n + "'));");
+    }
+  }
+  std::vector<std::string_view> inputs(sources.begin(), sources.end());
+
+  for (unsigned threads : {1u, 3u, 8u, 0u}) {
+    auto results = lexer::parse_commonjs_batch(inputs, {.threads = threads});
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      auto expected = lexer::parse_commonjs(inputs[i]);
+      ASSERT_EQ(results[i].analysis.has_value(), expected.has_value()) << i;
+      if (!expected) {
+        ASSERT_EQ(results[i].error, lexer::get_last_error()) << i;
+        continue;
+      }
+      ASSERT_FALSE(results[i].error.has_value());
+      ASSERT_EQ(results[i].analysis->exports.size(), expected->exports.size()) << i;
+      for (size_t j = 0; j < expected->exports.size(); ++j) {
+        ASSERT_EQ(lexer::get_string_view(results[i].analysis->exports[j]), lexer::get_string_view(expected->exports[j]));
+        ASSERT_EQ(results[i].analysis->exports[j].line, expected->exports[j].line);
+      }
+      ASSERT_EQ(results[i].analysis->re_exports.size(), expected->re_exports.size()) << i;
+    }
+  }
+
+  ASSERT_TRUE(lexer::parse_commonjs_batch({}).empty());
+  std::string_view single[] = {"exports.only = 1;"};
+  auto results = lexer::parse_commonjs_batch(single, {.threads = 4});
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(lexer::get_string_view(results[0].analysis->exports[0]), "only");
+
+  // The calling thread's last error is left as it was.
+  ASSERT_FALSE(lexer::parse_commonjs("import 'x';").has_value());
+  std::string_view mixed[] = {"exports.a = 1;", "export default 1;", "exports.b = 1;"};
+  for (unsigned threads : {1u, 3u}) {
+    results = lexer::parse_commonjs_batch(mixed, {.threads = threads});
+    ASSERT_EQ(results[1].error, lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+    ASSERT_EQ(lexer::get_string_view(results[2].analysis->exports[0]), "b");
+    ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+  }
+}
+
+TEST(real_world_tests, parse_commonjs_result) {
+  lexer::parse_result result = lexer::parse_commonjs_result("exports.a = 1;\nexports.b = 2;");
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->exports.size(), 2);
+  ASSERT_EQ(result->exports[1].line, 2);
+
+  // The error stays with its result, whatever is parsed afterwards.
+  lexer::parse_result failed = lexer::parse_commonjs_result("import 'x';");
+  ASSERT_TRUE(lexer::parse_commonjs("exports.c = 3;").has_value());
+  ASSERT_FALSE(failed);
+  ASSERT_EQ(failed.error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+  ASSERT_FALSE(lexer::get_last_error().has_value());
+
+  lexer::lexer_analysis analysis = std::move(result).value();
+  ASSERT_EQ(lexer::get_string_view(analysis.exports[0]), "a");
+}
+
+TEST(real_world_tests, unterminated_tokens_report_errors) {
+  std::pair<const char*, lexer::lexer_error> cases[] = {
+      {"exports.a = (1", lexer::lexer_error::UNTERMINATED_PAREN},
+      {"function f() {", lexer::lexer_error::UNTERMINATED_BRACE},
+      {"class A {", lexer::lexer_error::UNTERMINATED_BRACE},
+      {"var s = `${a", lexer::lexer_error::UNTERMINATED_TEMPLATE_STRING},
+      {"var s = `${f(a", lexer::lexer_error::UNTERMINATED_PAREN},
+      {"f({ a: `${ { b", lexer::lexer_error::UNTERMINATED_BRACE},
+  };
+  for (const auto& [source, error] : cases) {
+    ASSERT_FALSE(lexer::parse_commonjs(source).has_value()) << source;
+    ASSERT_EQ(lexer::get_last_error(), error) << source;
+    lexer::parse_result result = lexer::parse_commonjs_result(source);
+    ASSERT_FALSE(result.has_value()) << source;
+    ASSERT_EQ(result.error(), error) << source;
+  }
+}
+
+TEST(real_world_tests, error_location) {
+  // Detected at the offending token.
+  std::string_view esm = "exports.a = 1;\r\nexports.b = 2;\nexport const c = 3;";
+  lexer::parse_result result = lexer::parse_commonjs_result(esm);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.location().offset, esm.find("export const"));
+  ASSERT_EQ(result.location().line, 3);
+  ASSERT_FALSE(lexer::parse_commonjs(esm).has_value());
+  ASSERT_EQ(lexer::get_last_error_location()->offset, result.location().offset);
+  ASSERT_EQ(lexer::get_last_error_location()->line, 3);
+
+  // Tokens left open are only detected at the end of the input.
+  std::string_view unclosed = "module.exports = {\n  a: 1,\n";
+  result = lexer::parse_commonjs_result(unclosed);
+  ASSERT_EQ(result.error(), lexer::lexer_error::UNTERMINATED_BRACE);
+  ASSERT_EQ(result.location().offset, unclosed.size());
+  ASSERT_EQ(result.location().line, 3);
+
+  lexer::parser parser;
+  ASSERT_EQ(parser.parse("\n\n)"), nullptr);
+  ASSERT_EQ(lexer::get_last_error_location()->offset, 2);
+  ASSERT_EQ(lexer::get_last_error_location()->line, 3);
+  ASSERT_NE(parser.parse("exports.a = 1;"), nullptr);
+  ASSERT_FALSE(lexer::get_last_error_location().has_value());
+
+  std::string_view batch[] = {"exports.a = 1;", "\nimport 'x';"};
+  auto results = lexer::parse_commonjs_batch(batch);
+  ASSERT_FALSE(results[0].location.has_value());
+  ASSERT_EQ(results[1].location->offset, 1);
+  ASSERT_EQ(results[1].location->line, 2);
+
+  // Offsets are 32-bit, so larger sources are rejected before they are read.
+  if constexpr (sizeof(size_t) > sizeof(uint32_t)) {
+    size_t huge = size_t{std::numeric_limits<uint32_t>::max()} + 1;
+    std::string_view source("exports.a = 1;", huge);
+    for (const auto& failed : {lexer::parse_commonjs_result(source), lexer::parse_commonjs_validated_result(source),
+                               lexer::parse_commonjs_result(std::u16string_view(u"exports.a = 1;", huge))}) {
+      ASSERT_EQ(failed.error(), lexer::lexer_error::SOURCE_TOO_LARGE);
+      ASSERT_EQ(failed.location().offset, 0);
+      ASSERT_EQ(failed.location().line, 1);
+    }
+  }
+}
+
+TEST(real_world_tests, parse_commonjs_file) {
+  std::filesystem::path path = std::filesystem::temp_directory_path() / "merve_parse_commonjs_file.js";
+  std::ofstream(path, std::ios::binary) << "exports.a = 1;\nexports['b\\u0063'] = 2;\nmodule.exports = require('./c');";
+
+  std::error_code ec;
+  std::optional<lexer::file_analysis> file = lexer::parse_commonjs_file(path, ec);
+  ASSERT_FALSE(ec);
+  ASSERT_TRUE(file.has_value());
+  // Names that need no unescaping point into the mapped file, which moves
+  // with the result.
+  lexer::file_analysis moved = std::move(*file);
+  file.reset();
+  std::string_view source = moved.source();
+  std::string_view a = lexer::get_string_view(moved->exports[0]);
+  ASSERT_EQ(a, "a");
+  ASSERT_GE(a.data(), source.data());
+  ASSERT_LT(a.data(), source.data() + source.size());
+  ASSERT_EQ(lexer::get_string_view(moved->exports[1]), "bc");
+  ASSERT_EQ(moved->exports[1].line, 2);
+  ASSERT_EQ(lexer::get_string_view(moved.analysis().re_exports[0]), "./c");
+
+  std::ofstream(path, std::ios::binary) << "import 'x';";
+  ASSERT_FALSE(lexer::parse_commonjs_file(path, ec).has_value());
+  ASSERT_FALSE(ec);
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_IMPORT);
+
+  std::ofstream(path, std::ios::binary).close();
+  file = lexer::parse_commonjs_file(path);
+  ASSERT_TRUE(file.has_value());
+  ASSERT_TRUE(file->source().empty());
+  ASSERT_TRUE((**file).exports.empty());
+
+  std::filesystem::remove(path);
+  ASSERT_FALSE(lexer::parse_commonjs_file(path, ec).has_value());
+  ASSERT_EQ(ec, std::errc::no_such_file_or_directory);
+}
+
+#ifndef _WIN32
+TEST(real_world_tests, parse_commonjs_page_sized_file) {
+  // A mapping of a file whose size is a multiple of the page size is not
+  // followed by a NUL: the lexer must not read past the end of the source.
+  size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  std::filesystem::path path = std::filesystem::temp_directory_path() /
+                               ("merve_page_sized_file_" + std::to_string(getpid()) + ".js");
+  std::string_view head = "exports.a = 1;\n";
+  for (std::string_view tail : {";", "b", "exports.b", "'x", "\"x\\", "/x", "/[x", "`${", "/*", "//", "class",
+                                "__export(", "_interopRequireWildcard)/x/", "Object.keys(x).forEach(function (k) { if"}) {
+    std::string contents(head);
+    contents.append(page - head.size() - tail.size(), ' ');
+    contents.append(tail);
+    std::ofstream(path, std::ios::binary) << contents;
+
+    // Map the file in front of a page that cannot be read.
+    void* region = mmap(nullptr, 2 * page, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(region, MAP_FAILED);
+    int fd = open(path.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+    void* mapped = mmap(region, page, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    close(fd);
+    ASSERT_EQ(mapped, region);
+    std::string_view source(static_cast<const char*>(mapped), page);
+
+    auto result = lexer::parse_commonjs(source);
+    if (tail == ";" || tail == "b" || tail == "//" || tail == "class") {
+      ASSERT_TRUE(result.has_value()) << tail;
+      ASSERT_EQ(lexer::get_string_view(result->exports[0]), "a");
+    }
+    lexer::parse_commonjs_validated(source);
+    lexer::parse_commonjs_latin1(source);
+    ASSERT_EQ(lexer::parse_commonjs_file(path).has_value(), result.has_value()) << tail;
+    munmap(region, 2 * page);
+  }
+  std::filesystem::remove(path);
+}
+#endif
+
+TEST(real_world_tests, parse_commonjs_shared) {
+  auto text = std::make_shared<const std::string>("exports.a = 1;\nexports['b\\u0063'] = 2;\nmodule.exports = require('./c');");
+  std::shared_ptr<const lexer::lexer_analysis> result =
+      lexer::parse_commonjs_shared({text, text->data()}, text->size());
+  ASSERT_NE(result, nullptr);
+  std::weak_ptr<const std::string> source = text;
+  text.reset();
+  // The result alone keeps the source alive.
+  ASSERT_FALSE(source.expired());
+  std::string_view a = lexer::get_string_view(result->exports[0]);
+  ASSERT_EQ(a, "a");
+  ASSERT_EQ(a.data(), source.lock()->data() + 8);
+  ASSERT_EQ(lexer::get_string_view(result->exports[1]), "bc");
+  ASSERT_EQ(result->exports[1].line, 2);
+  ASSERT_EQ(lexer::get_string_view(result->re_exports[0]), "./c");
+  result.reset();
+  ASSERT_TRUE(source.expired());
+
+  auto esm = std::make_shared<const std::string>("export default 1;");
+  ASSERT_EQ(lexer::parse_commonjs_shared({esm, esm->data()}, esm->size()), nullptr);
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(esm.use_count(), 1);
+}
+
+TEST(real_world_tests, parse_commonjs_utf16) {
+  // ASCII sources widen code unit by code unit; results must match UTF-8.
+  std::string source =
+      "exports.a = 1;\r\n"
+      "/* } */ module.exports = { b, 'c': 1, ...require('./d') };\n"
+      "Object.defineProperty(exports, 'e', { enumerable: true, get: function () { return m.e; } });\n"
+      "const s = `${ `x` }`; exports['f\\u0067'] = 1;\n"
+      "__exportStar(require('./h'), exports);";
+  std::u16string wide(source.begin(), source.end());
+  auto narrow_result = lexer::parse_commonjs(source);
+  auto wide_result = lexer::parse_commonjs(wide);
+  ASSERT_TRUE(narrow_result);
+  ASSERT_TRUE(wide_result);
+  auto names = [](const std::vector<lexer::export_entry>& entries) {
+    std::vector<std::pair<std::string, uint32_t>> out;
+    for (const auto& entry : entries) {
+      out.emplace_back(std::string(lexer::get_string_view(entry)), entry.line);
+    }
+    return out;
+  };
+  ASSERT_EQ(names(wide_result->exports), names(narrow_result->exports));
+  ASSERT_EQ(names(wide_result->re_exports), names(narrow_result->re_exports));
+
+  // Non-ASCII names, including one outside the BMP, come back as UTF-8.
+  auto result = lexer::parse_commonjs(u"exports.café = 1;\nexports['\U0001F600'] = 2;\nexports['\\u00e9'] = 3;");
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->exports.size(), 3);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "caf\xc3\xa9");
+  ASSERT_EQ(lexer::get_string_view(result->exports[1]), "\xf0\x9f\x98\x80");
+  ASSERT_EQ(result->exports[1].line, 2);
+  ASSERT_EQ(lexer::get_string_view(result->exports[2]), "\xc3\xa9");
+
+  // Code units below 0x100 classify as Latin-1: 0xA0 is a no-break space and
+  // '×' does not continue an identifier.
+  std::string latin1 = "exports.a\xa0= 1; exports.b\xd7 = 2;";
+  auto latin1_result = lexer::parse_commonjs_latin1(latin1);
+  result = lexer::parse_commonjs(std::u16string_view(u"exports.a\u00A0= 1; exports.b\u00D7 = 2;"));
+  ASSERT_TRUE(latin1_result);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(names(result->exports), names(latin1_result->exports));
+  ASSERT_EQ(result->exports.size(), 1);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "a");
+  // Beyond Latin-1, code units still continue identifiers.
+  result = lexer::parse_commonjs(u"exports.a\u0100 = 1;");
+  ASSERT_TRUE(result);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "a\xc4\x80");
+
+  // Names with a lone surrogate are skipped.
+  const char16_t lone[] = {u'e', u'x', u'p', u'o', u'r', u't', u's', u'[', u'\'', 0xD800, u'\'', u']', u' ', u'=', u' ', u'1', u';'};
+  result = lexer::parse_commonjs(std::u16string_view(lone, std::size(lone)));
+  ASSERT_TRUE(result);
+  ASSERT_TRUE(result->exports.empty());
+
+  // Errors are reported in code units.
+  lexer::parse_result failed = lexer::parse_commonjs_result(u"const é = 1;\nexport default 1;");
+  ASSERT_FALSE(failed);
+  ASSERT_EQ(failed.error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(failed.location().offset, 13);
+  ASSERT_EQ(failed.location().line, 2);
+}
+
+TEST(real_world_tests, parse_commonjs_latin1) {
+  // 0xE9 is 'é', 0xA0 a no-break space and 0xD7 '×'.
+  std::string source = "exports.caf\xe9 = 1;\xa0" "exports.b = 2;\n/* \xd7 */exports.c = 3;";
+  // Larger than the structural index threshold, which must not apply.
+  source += std::string(2048, ' ');
+  auto result = lexer::parse_commonjs_latin1(source);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->exports.size(), 3);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "caf\xc3\xa9");
+  ASSERT_EQ(lexer::get_string_view(result->exports[1]), "b");
+  ASSERT_EQ(lexer::get_string_view(result->exports[2]), "c");
+  ASSERT_EQ(result->exports[2].line, 2);
+  // ASCII names refer to the source.
+  ASSERT_TRUE(std::holds_alternative<std::string_view>(result->exports[1].name));
+  ASSERT_EQ(lexer::get_string_view(result->exports[1]).data(), source.data() + 26);
+
+  // As UTF-8, the no-break space would continue an identifier.
+  result = lexer::parse_commonjs(source);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->exports.size(), 2);
+  ASSERT_EQ(lexer::get_string_view(result->exports[1]), "c");
+
+  result = lexer::parse_commonjs_latin1("exports['\xa9\\u00e9'] = 1;");
+  ASSERT_TRUE(result);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "\xc2\xa9\xc3\xa9");
+
+  lexer::parse_result failed = lexer::parse_commonjs_latin1_result("const \xe9 = 1;\nexport default 1;");
+  ASSERT_FALSE(failed);
+  ASSERT_EQ(failed.error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(failed.location().offset, 13);
+}
+
+TEST(real_world_tests, parse_commonjs_validated) {
+  std::string valid = "exports.caf\xc3\xa9 = '\xf0\x9f\x98\x80';\n";
+  auto result = lexer::parse_commonjs_validated(valid);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(lexer::get_string_view(result->exports[0]), "caf\xc3\xa9");
+
+  // Truncated, overlong, surrogate, out of range and stray continuation bytes.
+  for (std::string_view invalid : {"\xc3", "\xc0\x80", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\x80", "\xe2\x82"}) {
+    std::string source = "exports.a = 1;\n// " + std::string(invalid) + "\nexports.b = 2;";
+    ASSERT_TRUE(lexer::parse_commonjs(source));
+    lexer::parse_result failed = lexer::parse_commonjs_validated_result(source);
+    ASSERT_FALSE(failed) << invalid;
+    ASSERT_EQ(failed.error(), lexer::lexer_error::INVALID_UTF8);
+    ASSERT_EQ(failed.location().offset, 18);
+    ASSERT_EQ(failed.location().line, 2);
+  }
+
+  // Invalid UTF-8 past the validation chunks the lexer reached, past a
+  // sequence split across chunks, and after another error.
+  std::string large;
+  for (int i = 0; i < 4000; i++) {
+    large += "exports.x" + std::to_string(i) + " = '\xe2\x82\xac';\n";
+  }
+  ASSERT_TRUE(lexer::parse_commonjs_validated(large));
+  for (std::string tail : {"/* \xff */", "export default 1; \xff"}) {
+    lexer::parse_result failed = lexer::parse_commonjs_validated_result(large + tail);
+    ASSERT_FALSE(failed);
+    ASSERT_EQ(failed.error(), lexer::lexer_error::INVALID_UTF8);
+    ASSERT_EQ(failed.location().offset, large.size() + tail.size() - (tail[0] == '/' ? 4 : 1));
+  }
+  ASSERT_EQ(lexer::get_last_error(), std::nullopt);
+  ASSERT_FALSE(lexer::parse_commonjs_validated(large + "\xff"));
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::INVALID_UTF8);
+}
+
+TEST(real_world_tests, analysis_cache) {
+  ASSERT_EQ(lexer::hash_source("exports.a = 1;"), lexer::hash_source(std::string("exports.a = 1;")));
+  ASSERT_NE(lexer::hash_source("exports.a = 1;"), lexer::hash_source("exports.b = 1;"));
+  ASSERT_NE(lexer::hash_source(std::string_view("\0", 1)), lexer::hash_source(std::string_view("\0\0", 2)));
+  // Blocks must neither vanish nor commute, whatever their content. These
+  // two words once zeroed both lanes of the hash.
+  const uint64_t words[2] = {0xe7037ed1a0b428dbull, 0x589965cc75374cc3ull};
+  std::string crafted(reinterpret_cast<const char*>(words), sizeof(words));
+  std::string block = "exports.a = 1;\n\n";
+  ASSERT_NE(lexer::hash_source(crafted + block), lexer::hash_source(block + crafted));
+  ASSERT_NE(lexer::hash_source(crafted + crafted), lexer::hash_source(crafted + std::string(16, '\0')));
+  ASSERT_NE(lexer::hash_source(block + block), lexer::hash_source(std::string(16, '\0') + block));
+
+  lexer::analysis_cache cache(2, 1);
+  std::string a = "exports.a = 1;\nexports['\\u0062'] = 2;";
+  auto first = cache.parse(a);
+  ASSERT_NE(first, nullptr);
+  // The result is a copy: it survives the source and its eviction.
+  a.assign(a.size(), ' ');
+  auto again = cache.parse("exports.a = 1;\nexports['\\u0062'] = 2;");
+  ASSERT_EQ(again, first);
+  ASSERT_EQ(first->exports().size(), 2);
+  ASSERT_EQ(first->name(first->exports()[1]), "b");
+  ASSERT_EQ(first->exports()[1].line, 2);
+  lexer::cache_statistics stats = cache.statistics();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.size, 1);
+
+  // Failures are cached and reported through get_last_error().
+  ASSERT_EQ(cache.parse("export default 1;"), nullptr);
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+  ASSERT_NE(cache.parse("exports.a = 1;\nexports['\\u0062'] = 2;"), nullptr);
+  ASSERT_EQ(lexer::get_last_error(), std::nullopt);
+  ASSERT_EQ(cache.parse("export default 1;"), nullptr);
+  ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+  ASSERT_EQ(cache.statistics().hits, 3);
+
+  // A third source evicts the least recently used one.
+  ASSERT_NE(cache.parse("exports.c = 1;"), nullptr);
+  ASSERT_EQ(cache.statistics().size, 2);
+  ASSERT_NE(cache.parse("exports.a = 1;\nexports['\\u0062'] = 2;"), first);
+  ASSERT_EQ(first->name(first->exports()[0]), "a");
+  ASSERT_EQ(cache.statistics().misses, 4);
+
+  cache.clear();
+  stats = cache.statistics();
+  ASSERT_EQ(stats.hits + stats.misses + stats.size, 0);
+
+  // Concurrent lookups of overlapping sources.
+  lexer::analysis_cache shared(64);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&shared] {
+      for (int i = 0; i < 1000; i++) {
+        std::string source = "exports.x" + std::to_string(i % 100) + " = 1;";
+        auto result = shared.parse(source);
+        ASSERT_NE(result, nullptr);
+        ASSERT_EQ(result->name(result->exports()[0]), "x" + std::to_string(i % 100));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  stats = shared.statistics();
+  ASSERT_EQ(stats.hits + stats.misses, 4000);
+  ASSERT_LE(stats.size, 64);
+}
+
+TEST(real_world_tests, disk_cache) {
+  // A directory of its own, so concurrent runs do not share the file.
+  std::filesystem::path dir;
+  std::random_device random;
+  do {
+    dir = std::filesystem::temp_directory_path() / ("merve_disk_cache_" + std::to_string(random()));
+  } while (!std::filesystem::create_directory(dir));
+  std::filesystem::path path = dir / "cache";
+  std::string source = "exports.a = 1;\nmodule.exports = require('./b');";
+  lexer::source_hash custom = lexer::hash_source("b.js:42");
+
+  {
+    lexer::disk_cache cache(path);
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_FALSE(cache.find(lexer::hash_source(source)).has_value());
+    auto result = cache.parse(source);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->exports().size(), 1);
+    ASSERT_EQ(result->name(result->exports()[0]), "a");
+    // Failures are cached too.
+    ASSERT_FALSE(cache.parse("export default 1;").has_value());
+    ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+    ASSERT_TRUE(cache.parse(custom, "exports.z = 2;").has_value());
+    // A source of another length under the same key replaces the result.
+    auto replaced = cache.parse(custom, "exports.b = 2; ");
+    ASSERT_TRUE(replaced.has_value());
+    ASSERT_EQ(replaced->name(replaced->exports()[0]), "b");
+    ASSERT_EQ(cache.find(custom)->name(cache.find(custom)->exports()[0]), "b");
+    // Views of added results outlive later additions.
+    for (int i = 0; i < 100; i++) {
+      ASSERT_TRUE(cache.parse("exports.x" + std::to_string(i) + " = 1;").has_value());
+    }
+    ASSERT_EQ(result->name(result->re_exports()[0]), "./b");
+    ASSERT_EQ(cache.size(), 103);
+    std::error_code ec;
+    ASSERT_TRUE(cache.save(ec)) << ec.message();
+
+    // A moved-from cache works in memory only.
+    lexer::disk_cache moved = std::move(cache);
+    ASSERT_TRUE(moved.find(custom).has_value());
+    ASSERT_FALSE(cache.find(custom).has_value());
+    ASSERT_TRUE(cache.parse(source).has_value());
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_FALSE(cache.save(ec));
+    ASSERT_EQ(ec, std::errc::invalid_argument);
+  }
+
+  {
+    lexer::disk_cache cache(path);
+    ASSERT_EQ(cache.size(), 103);
+    auto found = cache.find(lexer::hash_source(source));
+    ASSERT_TRUE(found.has_value());
+    ASSERT_EQ(found->name(found->re_exports()[0]), "./b");
+    ASSERT_EQ(found->exports()[0].line, 1);
+    auto custom_found = cache.find(custom);
+    ASSERT_TRUE(custom_found.has_value());
+    ASSERT_EQ(custom_found->name(custom_found->exports()[0]), "b");
+    auto failed = cache.find(lexer::hash_source("export default 1;"));
+    ASSERT_TRUE(failed.has_value());
+    ASSERT_EQ(failed->error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+    ASSERT_FALSE(cache.parse("export default 1;").has_value());
+    ASSERT_EQ(lexer::get_last_error(), lexer::lexer_error::UNEXPECTED_ESM_EXPORT);
+    ASSERT_TRUE(cache.parse(source).has_value());
+    ASSERT_EQ(lexer::get_last_error(), std::nullopt);
+
+    // Another cache saving meanwhile keeps what is on disk, and this one's
+    // mapping of the old file stays valid.
+    lexer::disk_cache other(path);
+    ASSERT_TRUE(other.parse("exports.c = 3;").has_value());
+    std::error_code ec;
+    ASSERT_TRUE(other.save(ec));
+    ASSERT_EQ(found->name(found->exports()[0]), "a");
+    ASSERT_EQ(lexer::disk_cache(path).size(), 104);
+    // So can this cache, which still has the file open, including on
+    // Windows.
+    ASSERT_TRUE(cache.save(ec)) << ec.message();
+    ASSERT_EQ(found->name(found->exports()[0]), "a");
+    ASSERT_EQ(lexer::disk_cache(path).size(), 104);
+  }
+
+  // A key on disk that is replaced counts once.
+  {
+    lexer::disk_cache cache(path);
+    ASSERT_TRUE(cache.find(custom).has_value());
+    ASSERT_TRUE(cache.parse(custom, "exports.b = 2;  ").has_value());
+    ASSERT_EQ(cache.size(), 104);
+    ASSERT_TRUE(cache.parse("exports.d = 4;").has_value());
+    ASSERT_EQ(cache.size(), 105);
+  }
+
+  // Damaged files, and files of another version, are ignored.
+  {
+    std::string contents;
+    {
+      std::ifstream in(path, std::ios::binary);
+      contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    std::string other_version = contents;
+    other_version[8] = '0' == other_version[8] ? '9' : '0';
+    for (const std::string& bad : {other_version, contents.substr(0, contents.size() / 2), std::string("garbage")}) {
+      {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << bad;
+      }
+      lexer::disk_cache cache(path);
+      ASSERT_EQ(cache.size(), 0);
+      ASSERT_FALSE(cache.find(lexer::hash_source(source)).has_value());
+      ASSERT_TRUE(cache.parse(source).has_value());
+    }
+  }
+
+  std::filesystem::remove_all(dir);
+}